@@ -0,0 +1,67 @@
+// Streaming and random-access scans over a large s21::vector<float>, once
+// with the default allocator and once with s21::hugepage_allocator.
+// Usage: bench_hugepage.out [megabytes]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../s21_containers/s21_vector.h"
+#include "../s21_containersplus/s21_hugepage_allocator.h"
+
+namespace {
+template <typename Function>
+double Milliseconds(Function function) {
+  auto start = std::chrono::steady_clock::now();
+  function();
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+template <typename Vector>
+void Run(const char *name, Vector vector, size_t size) {
+  double fill = Milliseconds([&] {
+    vector.reserve(size);
+    for (size_t i = 0; i < size; ++i) vector.push_back(float(i & 1023));
+  });
+
+  volatile float sink = 0;
+  double stream = Milliseconds([&] {
+    float sum = 0;
+    for (size_t i = 0; i < size; ++i) sum += vector[i];
+    sink = sum;
+  });
+
+  double random = Milliseconds([&] {
+    float sum = 0;
+    size_t index = 12345;
+    for (size_t i = 0; i < size / 4; ++i) {
+      index = (index * 6364136223846793005ULL + 1442695040888963407ULL);
+      sum += vector[(index >> 17) % size];
+    }
+    sink = sum;
+  });
+  (void)sink;
+
+  std::printf("%-10s fill %9.1f ms  stream %9.1f ms  random %9.1f ms\n", name,
+              fill, stream, random);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t megabytes = (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 512);
+  size_t size = megabytes * (size_t(1) << 20) / sizeof(float);
+  std::printf("%zu floats (%zu MB)\n", size, megabytes);
+
+  Run("default", s21::vector<float>(), size);
+  Run("hugepage", s21::vector<float, s21::hugepage_allocator<float>>(), size);
+
+  s21::hugepage_options options;
+  options.explicit_pages = true;
+  Run("explicit",
+      s21::vector<float, s21::hugepage_allocator<float>>(
+          s21::hugepage_allocator<float>(options)),
+      size);
+  return 0;
+}
@@ -0,0 +1,101 @@
+// Time of s21::parallel sort, transform, reduce and inclusive_scan over an
+// s21::vector<int> on pools of 1, 2, 4, ... threads up to the core count,
+// against the sequential standard algorithms.
+// Usage: bench_parallel.out [elements]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+
+#include "../s21_containers/s21_vector.h"
+#include "../s21_containersplus/s21_parallel.h"
+
+namespace {
+// Best time of a few runs, in milliseconds; prepare() runs untimed first.
+template <typename Prepare, typename Function>
+double Milliseconds(Prepare prepare, Function function) {
+  double best = 0;
+  for (int run = 0; run < 3; ++run) {
+    prepare();
+    auto start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    if (run == 0 || elapsed.count() < best) best = elapsed.count();
+  }
+  return best;
+}
+
+void PrintRow(const char *name, double sort, double transform, double reduce,
+              double scan) {
+  std::printf("%-10s %10.1f %10.1f %10.1f %10.1f\n", name, sort, transform,
+              reduce, scan);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t size =
+      (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : size_t(10000000));
+  s21::vector<int> input(size), work(size), output(size);
+  std::mt19937 engine(1);
+  for (int &value : input) value = int(engine());
+  auto reset = [&] { std::copy(input.begin(), input.end(), work.begin()); };
+  auto none = [] {};
+  auto twice = [](int value) { return value * 2 + 1; };
+  volatile long long sink = 0;
+
+  std::printf("%zu ints, %u hardware threads\n", size,
+              std::thread::hardware_concurrency());
+  std::printf("%-10s %10s %10s %10s %10s   (ms)\n", "threads", "sort",
+              "transform", "reduce", "scan");
+  PrintRow(
+      "std",
+      Milliseconds(reset, [&] { std::sort(work.begin(), work.end()); }),
+      Milliseconds(none,
+                   [&] {
+                     std::transform(input.begin(), input.end(),
+                                    output.begin(), twice);
+                   }),
+      Milliseconds(none,
+                   [&] {
+                     sink = std::accumulate(input.begin(), input.end(), 0LL);
+                   }),
+      Milliseconds(none, [&] {
+        std::inclusive_scan(input.begin(), input.end(), output.begin());
+      }));
+
+  size_t cores = s21::thread_pool::default_thread_count();
+  for (size_t threads = 1;; threads = std::min(threads * 2, cores)) {
+    // The calling thread works too, so a pool of n - 1 runs on n threads.
+    s21::thread_pool pool(threads - 1);
+    char name[16];
+    std::snprintf(name, sizeof(name), "%zu", threads);
+    PrintRow(
+        name,
+        Milliseconds(reset,
+                     [&] {
+                       s21::parallel::sort(pool, work.begin(), work.end());
+                     }),
+        Milliseconds(none,
+                     [&] {
+                       s21::parallel::transform(pool, input.begin(),
+                                                input.end(), output.begin(),
+                                                twice);
+                     }),
+        Milliseconds(none,
+                     [&] {
+                       sink = s21::parallel::reduce(pool, input.begin(),
+                                                    input.end(), 0LL);
+                     }),
+        Milliseconds(none, [&] {
+          s21::parallel::inclusive_scan(pool, input.begin(), input.end(),
+                                        output.begin());
+        }));
+    if (threads == cores) break;
+  }
+  (void)sink;
+  return 0;
+}
@@ -0,0 +1,76 @@
+// Time of s21::radix_sort against std::sort on s21::vector<uint64_t>,
+// s21::vector<float> and records keyed by a uint32_t, sequential and on
+// the default thread pool, reusing one scratch vector.
+// Usage: bench_radix_sort.out [elements]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "../s21_containers/s21_vector.h"
+#include "../s21_containersplus/s21_radix_sort.h"
+
+namespace {
+struct Record {
+  uint32_t key;
+  uint32_t payload[3];
+};
+
+// Best time of a few runs, in milliseconds, sorting a fresh copy each time.
+template <typename T, typename Function>
+double Milliseconds(const s21::vector<T> &input, Function function) {
+  double best = 0;
+  for (int run = 0; run < 3; ++run) {
+    s21::vector<T> work = input;
+    auto start = std::chrono::steady_clock::now();
+    function(work);
+    std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    if (run == 0 || elapsed.count() < best) best = elapsed.count();
+  }
+  return best;
+}
+
+template <typename T, typename Key, typename Less>
+void Run(const char *name, const s21::vector<T> &input, Key key, Less less) {
+  s21::vector<T> scratch;
+  double std_sort = Milliseconds(
+      input, [&](s21::vector<T> &v) { std::sort(v.begin(), v.end(), less); });
+  double radix = Milliseconds(input, [&](s21::vector<T> &v) {
+    s21::radix_sort(v.begin(), v.end(), scratch, key);
+  });
+  double parallel = Milliseconds(input, [&](s21::vector<T> &v) {
+    s21::radix_sort(s21::thread_pool::default_pool(), v.begin(), v.end(),
+                    scratch, key);
+  });
+  std::printf("%-8s %10.1f %10.1f %10.1f\n", name, std_sort, radix, parallel);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t size =
+      (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : size_t(10000000));
+  std::mt19937_64 engine(3);
+  s21::vector<uint64_t> integers(size);
+  s21::vector<float> floats(size);
+  s21::vector<Record> records(size);
+  for (size_t i = 0; i < size; ++i) {
+    integers[i] = engine();
+    floats[i] = std::uniform_real_distribution<float>(-1e6f, 1e6f)(engine);
+    records[i].key = uint32_t(engine());
+  }
+
+  std::printf("%zu elements, %zu pool threads\n", size,
+              s21::thread_pool::default_pool().size());
+  std::printf("%-8s %10s %10s %10s   (ms)\n", "keys", "std::sort", "radix",
+              "parallel");
+  Run("uint64", integers, s21::radix_identity(), std::less<>());
+  Run("float", floats, s21::radix_identity(), std::less<>());
+  Run(
+      "record", records, [](const Record &r) { return r.key; },
+      [](const Record &a, const Record &b) { return a.key < b.key; });
+  return 0;
+}
@@ -0,0 +1,77 @@
+// Throughput of the s21::simd kernels over s21::vector<int> and
+// s21::vector<float> on every vector level the CPU supports, against the
+// scalar loops.
+// Usage: bench_simd.out [elements]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../s21_containers/s21_vector.h"
+#include "../s21_containersplus/s21_simd.h"
+
+namespace {
+const char *const kLevelNames[] = {"scalar", "v128", "v256", "v512"};
+
+// Best time of a few runs, in gigabytes of elements per second.
+template <typename Function>
+double Throughput(size_t bytes, Function function) {
+  double best = 0;
+  for (int run = 0; run < 5; ++run) {
+    auto start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    double rate = double(bytes) / elapsed.count() / 1e9;
+    if (rate > best) best = rate;
+  }
+  return best;
+}
+
+template <typename T>
+void Run(const char *name, size_t size) {
+  s21::vector<T> vector(size), other(size);
+  for (size_t i = 0; i < size; ++i) vector[i] = T(i % 1000);
+  other = vector;
+  size_t bytes = size * sizeof(T);
+  volatile double sink = 0;
+
+  std::printf("%s, %zu elements\n", name, size);
+  std::printf("%-8s %8s %8s %8s %8s %8s %8s   (GB/s)\n", "level", "find",
+              "count", "min", "sum", "fill", "equal");
+  for (int level = 0; level < 4; ++level) {
+    auto value = static_cast<s21::simd::level>(level);
+    if (value > s21::simd::supported_level()) break;
+    s21::simd::set_level(value);
+    double find = Throughput(bytes, [&] {
+      sink = double(s21::simd::find(vector, T(-1)) - vector.begin());
+    });
+    double count = Throughput(bytes, [&] {
+      sink = double(s21::simd::count(vector, T(7)));
+    });
+    double min = Throughput(bytes, [&] {
+      sink = double(*s21::simd::min_element(vector));
+    });
+    double sum = Throughput(bytes, [&] {
+      sink = double(s21::simd::sum(vector));
+    });
+    double fill = Throughput(bytes, [&] { s21::simd::fill(other, T(3)); });
+    other = vector;
+    double equal = Throughput(2 * bytes, [&] {
+      sink = double(s21::simd::equal(vector, other));
+    });
+    std::printf("%-8s %8.2f %8.2f %8.2f %8.2f %8.2f %8.2f\n",
+                kLevelNames[level], find, count, min, sum, fill, equal);
+  }
+  s21::simd::set_level(s21::simd::supported_level());
+  (void)sink;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t size =
+      (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : size_t(1) << 20);
+  Run<int>("int", size);
+  Run<float>("float", size);
+  return 0;
+}
@@ -0,0 +1,68 @@
+// Growth of an s21::vector of strings that outgrow the small-string buffer,
+// by push_back without reserve. Reallocation moves std::string, whose move
+// constructor is noexcept; a string with a throwing move constructor has to
+// be copied instead, which shows what every growth cost before elements were
+// moved. std::vector<std::string> is the reference.
+// Usage: bench_string_vector.out [elements]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers/s21_vector.h"
+
+namespace {
+// A string that move_if_noexcept copies on reallocation.
+struct CopiedString {
+  std::string value;
+
+  explicit CopiedString(std::string value) : value(std::move(value)) {}
+  CopiedString(const CopiedString &other) = default;
+  CopiedString(CopiedString &&other) noexcept(false)
+      : value(std::move(other.value)) {}
+  CopiedString &operator=(const CopiedString &other) = default;
+  CopiedString &operator=(CopiedString &&other) = default;
+};
+
+// Best time of a few runs, in milliseconds.
+template <typename Function>
+double Milliseconds(Function function) {
+  double best = 0;
+  for (int run = 0; run < 5; ++run) {
+    auto start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    if (run == 0 || elapsed.count() < best) best = elapsed.count();
+  }
+  return best;
+}
+
+template <typename Vector, typename Value>
+void Run(const char *name, size_t size) {
+  const std::string text(64, 'x');
+  volatile size_t sink = 0;
+  double time = Milliseconds([&] {
+    Vector vector;
+    for (size_t i = 0; i < size; ++i) vector.push_back(Value(text));
+    sink = vector.size();
+  });
+  (void)sink;
+  std::printf("%-32s %9.1f ms\n", name, time);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t size =
+      (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : size_t(1) << 20);
+  std::printf("push_back of %zu strings of 64 characters\n", size);
+  Run<s21::vector<std::string>, std::string>("s21::vector<string> (move)",
+                                             size);
+  Run<s21::vector<CopiedString>, CopiedString>(
+      "s21::vector<CopiedString> (copy)", size);
+  Run<std::vector<std::string>, std::string>("std::vector<string>", size);
+  return 0;
+}
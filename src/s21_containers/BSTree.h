@@ -2,15 +2,118 @@
 #ifndef S21_CONTAINERS_BSTREE_H
 #define S21_CONTAINERS_BSTREE_H
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../s21_containersplus/s21_parallel.h"
+#include "../s21_containersplus/s21_thread_pool.h"
 #include "s21_vector.h"
 
 namespace s21 {
-template <typename Tk, typename Td>
+// A tree augmentation keeps an Aug::value_type in every node (the aug field)
+// that summarises the node's subtree. Aug::update recomputes it from the node
+// and its children, and the tree calls it bottom-up whenever a subtree
+// changes.
+struct no_augment {
+  struct value_type {};
+  static constexpr bool enabled = false;
+  template <typename Node>
+  static void update(Node *) {}
+};
+
+// Keeps the monoid fold of every subtree, in key order, so RBTree::aggregate
+// can fold any key range in O(log n). Monoid supplies value_type, identity(),
+// an associative combine(a, b) and lift(key, data) for a single element.
+template <typename Monoid>
+struct monoid_augment {
+  using value_type = typename Monoid::value_type;
+  static constexpr bool enabled = true;
+  static value_type identity() { return Monoid::identity(); }
+  static value_type combine(const value_type &a, const value_type &b) {
+    return Monoid::combine(a, b);
+  }
+  template <typename Node>
+  static value_type lift(const Node *node) {
+    return Monoid::lift(node->key, node->data);
+  }
+  template <typename Node>
+  static void update(Node *node) {
+    value_type value = lift(node);
+    if (node->left != nullptr) value = combine(node->left->aug, value);
+    if (node->right != nullptr) value = combine(value, node->right->aug);
+    node->aug = std::move(value);
+  }
+};
+
+template <typename T>
+struct sum_monoid {
+  using value_type = T;
+  static value_type identity() { return T(); }
+  static value_type combine(const T &a, const T &b) { return a + b; }
+  template <typename K>
+  static value_type lift(const K &, const T &data) {
+    return data;
+  }
+};
+
+template <typename T>
+struct min_monoid {
+  using value_type = T;
+  static value_type identity() { return std::numeric_limits<T>::max(); }
+  static value_type combine(const T &a, const T &b) { return b < a ? b : a; }
+  template <typename K>
+  static value_type lift(const K &, const T &data) {
+    return data;
+  }
+};
+
+template <typename T>
+struct max_monoid {
+  using value_type = T;
+  static value_type identity() { return std::numeric_limits<T>::lowest(); }
+  static value_type combine(const T &a, const T &b) { return a < b ? b : a; }
+  template <typename K>
+  static value_type lift(const K &, const T &data) {
+    return data;
+  }
+};
+
+// Opts a tree into threaded iteration: every node also links to its in-order
+// neighbours, so iterators step with a single pointer chase instead of
+// walking the tree. Any other augmentation can be wrapped.
+template <typename Aug = no_augment>
+struct threaded_links : Aug {
+  static constexpr bool threaded = true;
+};
+
+template <typename Aug, typename = void>
+struct is_threaded : std::false_type {};
+
+template <typename Aug>
+struct is_threaded<Aug, std::void_t<decltype(Aug::threaded)>>
+    : std::bool_constant<Aug::threaded> {};
+
+template <typename Tk, typename Td, typename Aug = no_augment>
 class Tree {
  public:
   class Iterator;
 
  protected:
+  static constexpr bool kThreaded = is_threaded<Aug>::value;
+
+  class Node;
+  struct ThreadLinks {
+    Node *prev = nullptr;
+    Node *next = nullptr;
+  };
+  struct NoThreadLinks {};
+
   class Node {
    public:
     Tk key;
@@ -19,13 +122,36 @@ class Tree {
     Node *right = nullptr;
     Node *parent = nullptr;
     bool isRed;
+    typename Aug::value_type aug{};
+    std::conditional_t<kThreaded, ThreadLinks, NoThreadLinks> thread;
     Node(Tk key = Tk(), Td data = Td()) : key(key), data(data), isRed(true) {}
     Node(Tk key, Td data, Node *parent)
         : key(key), data(data), parent(parent), isRed(true) {}
   };
   Node *root;
   int size;
-
+  Node *slab = nullptr;
+  size_t slab_capacity = 0;
+  size_t slab_live = 0;
+
+  static constexpr size_t kParallelThreshold = 1 << 14;
+
+  void free_node(Node *node);
+  void release_node(Node *node);
+  void release_slab();
+  void refresh_path(Node *node);
+  void link_node(Node *node);
+  void link_all();
+
+  static size_t worker_count();
+  template <typename F>
+  static void run_parallel(size_t tasks, F task);
+  template <typename F>
+  static void WalkTree(Node *node, F visit);
+  static void SortByKey(std::pair<Tk, Td> *first, size_t count);
+  Node *LinkTree(Node *nodes, size_t lo, size_t hi, Node *parent,
+                 size_t depth, size_t red_depth, size_t spawn);
+  s21::vector<Node *> SplitTree(s21::vector<Node *> &upper);
   void remove_no(Node *&parent, Node *&temp);
   void remove_l(Node *&parent, Node *&temp);
   void remove_r(Node *&parent, Node *&temp);
@@ -43,8 +169,17 @@ class Tree {
   Tree(const Tree &other);
   Tree(Tree &&other) noexcept;
   ~Tree();
+  Tree &operator=(Tree &&other) noexcept;
 
-  Node *CopyTree(Node *node, Node *parent);
+  void CopyTree(const Tree &other);
+  void BuildTree(s21::vector<std::pair<Tk, Td>> &items);
+
+  template <typename F>
+  void parallel_for_each(F f);
+  template <typename Pred>
+  size_type parallel_count_if(Pred pred);
+  template <typename T, typename Op, typename Map>
+  T parallel_reduce(T init, Op op, Map map);
 
   void insert(Tk keyn, Td data);
   void replace(Tk keyn, Td data);
@@ -73,7 +208,7 @@ class Tree {
       cur = other.cur;
       return *this;
     }
-    explicit Iterator(Tree<Tk, Td> *tree) noexcept : tree(tree) {}
+    explicit Iterator(Tree<Tk, Td, Aug> *tree) noexcept : tree(tree) {}
     ~Iterator() = default;
 
     virtual value_type operator*();
@@ -88,7 +223,7 @@ class Tree {
   class ConstIterator : Iterator {
    public:
     ConstIterator() noexcept : Iterator() {}
-    explicit ConstIterator(Tree<Tk, Td> *tree) noexcept : Iterator(tree) {}
+    explicit ConstIterator(Tree<Tk, Td, Aug> *tree) noexcept : Iterator(tree) {}
     ~ConstIterator() = default;
     const_reference operator*() const { return Iterator::operator*(); };
   };
@@ -107,55 +242,405 @@ class Tree {
   class Readwrite {};
 };
 
-template <typename Tk, typename Td>
-Tree<Tk, Td>::Tree() {
+template <typename Tk, typename Td, typename Aug>
+Tree<Tk, Td, Aug>::Tree() {
   size = 0;
   root = nullptr;
 }
 
-template <typename Tk, typename Td>
-Tree<Tk, Td>::Tree(const Tree &other) {
-  root = CopyTree(other.root, nullptr);
-  set_size(other.sizeofTree());
+template <typename Tk, typename Td, typename Aug>
+Tree<Tk, Td, Aug>::Tree(const Tree &other) {
+  CopyTree(other);
 }
 
-template <typename Tk, typename Td>
-Tree<Tk, Td>::Tree(Tree &&other) noexcept {
+template <typename Tk, typename Td, typename Aug>
+Tree<Tk, Td, Aug>::Tree(Tree &&other) noexcept {
   root = other.root;
   set_size(other.sizeofTree());
+  std::swap(slab, other.slab);
+  std::swap(slab_capacity, other.slab_capacity);
+  std::swap(slab_live, other.slab_live);
   other.set_size(0);
   other.root = nullptr;
 }
 
-template <typename Tk, typename Td>
-Tree<Tk, Td>::~Tree() {
+template <typename Tk, typename Td, typename Aug>
+Tree<Tk, Td, Aug>::~Tree() {
   clear();
 }
 
-template <typename Tk, typename Td>
-typename Tree<Tk, Td>::Node *Tree<Tk, Td>::CopyTree(Tree::Node *node,
-                                                    Tree::Node *parent) {
-  if (node == nullptr) return nullptr;
-  Node *new_node = new Node(node->key, node->data, parent);
-  new_node->left = CopyTree(node->left, new_node);
-  new_node->right = CopyTree(node->right, new_node);
-  return new_node;
+template <typename Tk, typename Td, typename Aug>
+Tree<Tk, Td, Aug> &Tree<Tk, Td, Aug>::operator=(Tree &&other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
 }
 
-template <typename Tk, typename Td>
-void Tree<Tk, Td>::insert(Tk keyn, Td data) {
+// Copies the whole tree with a single allocation: the nodes are laid out in
+// BFS order inside one slab, and until a node is expanded its left pointer
+// holds the source node it was copied from, so no recursion or extra queue is
+// needed.
+template <typename Tk, typename Td, typename Aug>
+void Tree<Tk, Td, Aug>::CopyTree(const Tree &other) {
+  root = nullptr;
+  size = 0;
+  if (other.root == nullptr) return;
+  size_t count = other.sizeofTree();
+  Node *nodes = std::allocator<Node>().allocate(count);
+  size_t built = 0;
+  try {
+    new (nodes) Node(other.root->key, other.root->data, nullptr);
+    nodes->isRed = other.root->isRed;
+    nodes->aug = other.root->aug;
+    nodes->left = other.root;
+    built = 1;
+    for (size_t i = 0; i < built; ++i) {
+      Node *src = nodes[i].left;
+      nodes[i].left = nullptr;
+      for (Node *child : {src->left, src->right}) {
+        if (child == nullptr) continue;
+        if (built == count) {
+          throw std::logic_error("Tree size does not match its nodes");
+        }
+        Node *copy =
+            new (nodes + built) Node(child->key, child->data, &nodes[i]);
+        ++built;
+        copy->isRed = child->isRed;
+        copy->aug = child->aug;
+        copy->left = child;
+        if (child == src->left)
+          nodes[i].left = copy;
+        else
+          nodes[i].right = copy;
+      }
+    }
+  } catch (...) {
+    for (size_t i = 0; i < built; ++i) nodes[i].~Node();
+    std::allocator<Node>().deallocate(nodes, count);
+    throw;
+  }
+  slab = nodes;
+  slab_capacity = count;
+  slab_live = built;
+  root = nodes;
+  set_size(built);
+  link_all();
+}
+
+// Builds a balanced tree from unsorted pairs. The pairs are sorted in
+// parallel (a stable sort, so the first of several equal keys wins as with
+// repeated inserts), the nodes are constructed in parallel chunks into one
+// slab in key order, and the subtrees are linked concurrently. Nodes on the
+// deepest level are red, every other node is black.
+template <typename Tk, typename Td, typename Aug>
+void Tree<Tk, Td, Aug>::BuildTree(s21::vector<std::pair<Tk, Td>> &items) {
+  clear();
+  if (items.empty()) return;
+  std::pair<Tk, Td> *first = items.data();
+  SortByKey(first, items.size());
+  std::pair<Tk, Td> *last =
+      std::unique(first, first + items.size(),
+                  [](const std::pair<Tk, Td> &a, const std::pair<Tk, Td> &b) {
+                    return a.first == b.first;
+                  });
+  size_t count = last - first;
+  size_t red_depth = 0;
+  while ((size_t(2) << red_depth) <= count) ++red_depth;
+
+  size_t chunks = count < kParallelThreshold ? 1 : worker_count() * 4;
+  size_t step = (count + chunks - 1) / chunks;
+  Node *nodes = std::allocator<Node>().allocate(count);
+  s21::vector<char> built(chunks);
+  try {
+    run_parallel(chunks, [&](size_t chunk) {
+      size_t lo = std::min(count, chunk * step);
+      size_t hi = std::min(count, lo + step), i = lo;
+      try {
+        for (; i < hi; ++i) {
+          Node *node = new (nodes + i)
+              Node(std::move(first[i].first), std::move(first[i].second));
+          if constexpr (kThreaded) {
+            node->thread.prev = i > 0 ? node - 1 : nullptr;
+            node->thread.next = i + 1 < count ? node + 1 : nullptr;
+          }
+        }
+      } catch (...) {
+        while (i > lo) nodes[--i].~Node();
+        throw;
+      }
+      built[chunk] = 1;
+    });
+    root = LinkTree(nodes, 0, count, nullptr, 0, red_depth,
+                    chunks == 1 ? 1 : worker_count());
+  } catch (...) {
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+      if (!built[chunk]) continue;
+      size_t lo = std::min(count, chunk * step);
+      for (size_t i = lo; i < std::min(count, lo + step); ++i)
+        nodes[i].~Node();
+    }
+    std::allocator<Node>().deallocate(nodes, count);
+    throw;
+  }
+  slab = nodes;
+  slab_capacity = count;
+  slab_live = count;
+  set_size(count);
+}
+
+template <typename Tk, typename Td, typename Aug>
+void Tree<Tk, Td, Aug>::SortByKey(std::pair<Tk, Td> *first, size_t count) {
+  auto less = [](const std::pair<Tk, Td> &a, const std::pair<Tk, Td> &b) {
+    return a.first < b.first;
+  };
+  size_t chunks = count < kParallelThreshold ? 1 : worker_count();
+  size_t step = (count + chunks - 1) / chunks;
+  run_parallel(chunks, [&](size_t chunk) {
+    size_t lo = std::min(count, chunk * step);
+    std::stable_sort(first + lo, first + std::min(count, lo + step), less);
+  });
+  for (size_t width = step; width < count; width *= 2) {
+    run_parallel((count + 2 * width - 1) / (2 * width), [&](size_t pair) {
+      size_t lo = pair * 2 * width;
+      size_t mid = std::min(count, lo + width);
+      size_t hi = std::min(count, lo + 2 * width);
+      if (mid < hi)
+        std::inplace_merge(first + lo, first + mid, first + hi, less);
+    });
+  }
+}
+
+template <typename Tk, typename Td, typename Aug>
+typename Tree<Tk, Td, Aug>::Node *Tree<Tk, Td, Aug>::LinkTree(
+    Node *nodes, size_t lo, size_t hi, Node *parent, size_t depth,
+    size_t red_depth, size_t spawn) {
+  if (lo >= hi) return nullptr;
+  size_t mid = lo + (hi - lo) / 2;
+  Node *node = nodes + mid;
+  node->parent = parent;
+  node->isRed = depth == red_depth && depth != 0;
+  if (spawn > 1) {
+    Node *left = nullptr;
+    task_group group;
+    group.run([=, &left] {
+      left = LinkTree(nodes, lo, mid, node, depth + 1, red_depth, spawn / 2);
+    });
+    node->right = LinkTree(nodes, mid + 1, hi, node, depth + 1, red_depth,
+                           spawn - spawn / 2);
+    group.wait();
+    node->left = left;
+  } else {
+    node->left = LinkTree(nodes, lo, mid, node, depth + 1, red_depth, 1);
+    node->right = LinkTree(nodes, mid + 1, hi, node, depth + 1, red_depth, 1);
+  }
+  Aug::update(node);
+  return node;
+}
+
+// The threads of the default pool and the calling thread, which runs tasks
+// while it waits.
+template <typename Tk, typename Td, typename Aug>
+size_t Tree<Tk, Td, Aug>::worker_count() {
+  return thread_pool::default_pool().size() + 1;
+}
+
+// Runs task(0) .. task(tasks - 1) on the default pool, task(0) on the
+// calling thread. The first exception thrown by a task is rethrown once
+// every task has finished.
+template <typename Tk, typename Td, typename Aug>
+template <typename F>
+void Tree<Tk, Td, Aug>::run_parallel(size_t tasks, F task) {
+  if (tasks == 0) return;
+  parallel::detail::for_each_index(thread_pool::default_pool(), tasks, task);
+}
+
+template <typename Tk, typename Td, typename Aug>
+template <typename F>
+void Tree<Tk, Td, Aug>::WalkTree(Node *node, F visit) {
+  s21::vector<Node *> stack;
+  if (node != nullptr) stack.push_back(node);
+  while (!stack.empty()) {
+    Node *cur = stack.back();
+    stack.pop_back();
+    visit(cur);
+    if (cur->left != nullptr) stack.push_back(cur->left);
+    if (cur->right != nullptr) stack.push_back(cur->right);
+  }
+}
+
+// Splits the tree level by level until there are enough subtrees to keep
+// every worker busy. The roots of the subtrees are returned, the nodes above
+// them are collected in upper.
+template <typename Tk, typename Td, typename Aug>
+s21::vector<typename Tree<Tk, Td, Aug>::Node *> Tree<Tk, Td, Aug>::SplitTree(
+    s21::vector<Node *> &upper) {
+  s21::vector<Node *> tasks;
+  if (root != nullptr) tasks.push_back(root);
+  size_t parts = size_t(sizeofTree()) < kParallelThreshold
+                     ? 1
+                     : worker_count() * 4;
+  while (tasks.size() < parts) {
+    s21::vector<Node *> next;
+    for (Node *node : tasks) {
+      if (node->left != nullptr) next.push_back(node->left);
+      if (node->right != nullptr) next.push_back(node->right);
+    }
+    if (next.size() <= tasks.size()) break;
+    for (Node *node : tasks) upper.push_back(node);
+    tasks.swap(next);
+  }
+  return tasks;
+}
+
+// The parallel operations visit the elements in no particular order and may
+// call f, pred and map concurrently from several threads.
+template <typename Tk, typename Td, typename Aug>
+template <typename F>
+void Tree<Tk, Td, Aug>::parallel_for_each(F f) {
+  s21::vector<Node *> upper;
+  s21::vector<Node *> tasks = SplitTree(upper);
+  run_parallel(tasks.size(), [&](size_t i) {
+    WalkTree(tasks[i], [&](Node *node) { f(node->key, node->data); });
+  });
+  for (Node *node : upper) f(node->key, node->data);
+}
+
+template <typename Tk, typename Td, typename Aug>
+template <typename Pred>
+typename Tree<Tk, Td, Aug>::size_type Tree<Tk, Td, Aug>::parallel_count_if(
+    Pred pred) {
+  s21::vector<Node *> upper;
+  s21::vector<Node *> tasks = SplitTree(upper);
+  s21::vector<size_type> counts(tasks.size());
+  run_parallel(tasks.size(), [&](size_t i) {
+    size_type count = 0;
+    WalkTree(tasks[i], [&](Node *node) {
+      if (pred(node->key, node->data)) ++count;
+    });
+    counts[i] = count;
+  });
+  size_type total = 0;
+  for (size_type count : counts) total += count;
+  for (Node *node : upper)
+    if (pred(node->key, node->data)) ++total;
+  return total;
+}
+
+// op must be associative and commutative: the partial results of the
+// subtrees are combined in an unspecified order.
+template <typename Tk, typename Td, typename Aug>
+template <typename T, typename Op, typename Map>
+T Tree<Tk, Td, Aug>::parallel_reduce(T init, Op op, Map map) {
+  s21::vector<Node *> upper;
+  s21::vector<Node *> tasks = SplitTree(upper);
+  s21::vector<std::optional<T>> partial(tasks.size());
+  run_parallel(tasks.size(), [&](size_t i) {
+    WalkTree(tasks[i], [&](Node *node) {
+      if (partial[i])
+        partial[i] = op(std::move(*partial[i]), map(node->key, node->data));
+      else
+        partial[i] = map(node->key, node->data);
+    });
+  });
+  for (auto &part : partial)
+    if (part) init = op(std::move(init), std::move(*part));
+  for (Node *node : upper)
+    init = op(std::move(init), map(node->key, node->data));
+  return init;
+}
+
+// Unthreads the node from its neighbours before releasing it. Every node
+// that leaves the tree passes through here, so splicing out a node or its
+// successor keeps the in-order links consistent.
+template <typename Tk, typename Td, typename Aug>
+void Tree<Tk, Td, Aug>::free_node(Node *node) {
+  if constexpr (kThreaded) {
+    if (node->thread.prev != nullptr)
+      node->thread.prev->thread.next = node->thread.next;
+    if (node->thread.next != nullptr)
+      node->thread.next->thread.prev = node->thread.prev;
+  }
+  release_node(node);
+}
+
+template <typename Tk, typename Td, typename Aug>
+void Tree<Tk, Td, Aug>::release_node(Node *node) {
+  std::less<Node *> less;
+  if (slab != nullptr && !less(node, slab) &&
+      less(node, slab + slab_capacity)) {
+    node->~Node();
+    if (--slab_live == 0) release_slab();
+  } else {
+    delete node;
+  }
+}
+
+// Threads a freshly attached leaf between its in-order neighbours, one of
+// which is always its parent.
+template <typename Tk, typename Td, typename Aug>
+inline void Tree<Tk, Td, Aug>::link_node(Node *node) {
+  if constexpr (kThreaded) {
+    Node *parent = node->parent;
+    if (parent == nullptr) return;
+    if (parent->left == node) {
+      node->thread.next = parent;
+      node->thread.prev = parent->thread.prev;
+    } else {
+      node->thread.prev = parent;
+      node->thread.next = parent->thread.next;
+    }
+    if (node->thread.prev != nullptr) node->thread.prev->thread.next = node;
+    if (node->thread.next != nullptr) node->thread.next->thread.prev = node;
+  }
+}
+
+template <typename Tk, typename Td, typename Aug>
+void Tree<Tk, Td, Aug>::link_all() {
+  if constexpr (kThreaded) {
+    Node *prev = nullptr;
+    for (Node *cur = min(root); cur != nullptr; cur = successor(cur)) {
+      cur->thread.prev = prev;
+      if (prev != nullptr) prev->thread.next = cur;
+      prev = cur;
+    }
+  }
+}
+
+template <typename Tk, typename Td, typename Aug>
+inline void Tree<Tk, Td, Aug>::refresh_path(Node *node) {
+  if constexpr (Aug::enabled) {
+    for (; node != nullptr; node = node->parent) Aug::update(node);
+  }
+}
+
+template <typename Tk, typename Td, typename Aug>
+void Tree<Tk, Td, Aug>::release_slab() {
+  std::allocator<Node>().deallocate(slab, slab_capacity);
+  slab = nullptr;
+  slab_capacity = 0;
+  slab_live = 0;
+}
+
+template <typename Tk, typename Td, typename Aug>
+void Tree<Tk, Td, Aug>::insert(Tk keyn, Td data) {
   Node *cur = root;
   while (cur) {
     if (keyn < cur->key && cur->left == nullptr) {
       Node *newNode = new Node(keyn, data);
       cur->left = newNode;
       newNode->parent = cur;
+      link_node(newNode);
+      refresh_path(newNode);
       size++;
       return;
     } else if ((keyn > cur->key || keyn == cur->key) && cur->right == nullptr) {
       Node *newNode = new Node(keyn, data);
       cur->right = newNode;
       newNode->parent = cur;
+      link_node(newNode);
+      refresh_path(newNode);
       size++;
       return;
     } else if (keyn > cur->key || keyn == cur->key)
@@ -165,11 +650,12 @@ void Tree<Tk, Td>::insert(Tk keyn, Td data) {
   }
   size++;
   root = new Node(keyn, data);
+  refresh_path(root);
   return;
 }
 
-template <typename Tk, typename Td>
-inline void Tree<Tk, Td>::replace(Tk keyn, Td data) {
+template <typename Tk, typename Td, typename Aug>
+inline void Tree<Tk, Td, Aug>::replace(Tk keyn, Td data) {
   Node *cur = root;
   while (cur && cur->key != keyn) {
     if (keyn > cur->key)
@@ -179,10 +665,11 @@ inline void Tree<Tk, Td>::replace(Tk keyn, Td data) {
   }
   cur->key = keyn;
   cur->data = data;
+  refresh_path(cur);
 }
 
-template <typename Tk, typename Td>
-void Tree<Tk, Td>::find(Node *&temp, Node *&parent, Tk keyn) {
+template <typename Tk, typename Td, typename Aug>
+void Tree<Tk, Td, Aug>::find(Node *&temp, Node *&parent, Tk keyn) {
   while (temp != nullptr) {
     if (keyn == (temp)->key) {
       break;
@@ -196,9 +683,10 @@ void Tree<Tk, Td>::find(Node *&temp, Node *&parent, Tk keyn) {
   }
 }
 
-template <typename Tk, typename Td>
-inline typename Tree<Tk, Td>::Iterator Tree<Tk, Td>::findIter(Tk keyn) {
-  typename Tree<Tk, Td>::Iterator it = Tree<Tk, Td>::begin();
+template <typename Tk, typename Td, typename Aug>
+inline typename Tree<Tk, Td, Aug>::Iterator Tree<Tk, Td, Aug>::findIter(
+    Tk keyn) {
+  typename Tree<Tk, Td, Aug>::Iterator it = Tree<Tk, Td, Aug>::begin();
   while (keyn != (*it).first) {
     if (keyn < (*it).first) {
       --it;
@@ -210,17 +698,17 @@ inline typename Tree<Tk, Td>::Iterator Tree<Tk, Td>::findIter(Tk keyn) {
   return it;
 }
 
-template <typename Tk, typename Td>
-void Tree<Tk, Td>::remove_no(Node *&parent, Node *&temp) {
+template <typename Tk, typename Td, typename Aug>
+void Tree<Tk, Td, Aug>::remove_no(Node *&parent, Node *&temp) {
   if (parent->left == temp) {
     parent->left = nullptr;
   } else if (parent->right == temp)
     parent->right = nullptr;
-  delete temp;
+  free_node(temp);
 }
 
-template <typename Tk, typename Td>
-void Tree<Tk, Td>::remove_l(Node *&parent, Node *&temp) {
+template <typename Tk, typename Td, typename Aug>
+void Tree<Tk, Td, Aug>::remove_l(Node *&parent, Node *&temp) {
   if (parent->left == temp) {
     parent->left = temp->left;
     temp->left->parent = parent;
@@ -228,11 +716,11 @@ void Tree<Tk, Td>::remove_l(Node *&parent, Node *&temp) {
     parent->right = temp->left;
     temp->left->parent = parent;
   }
-  delete temp;
+  free_node(temp);
 }
 
-template <typename Tk, typename Td>
-void Tree<Tk, Td>::remove_r(Node *&parent, Node *&temp) {
+template <typename Tk, typename Td, typename Aug>
+void Tree<Tk, Td, Aug>::remove_r(Node *&parent, Node *&temp) {
   if (parent->left == temp) {
     parent->left = temp->right;
     temp->right->parent = parent;
@@ -240,11 +728,11 @@ void Tree<Tk, Td>::remove_r(Node *&parent, Node *&temp) {
     parent->right = temp->right;
     temp->right->parent = parent;
   }
-  delete temp;
+  free_node(temp);
 }
 
-template <typename Tk, typename Td>
-void Tree<Tk, Td>::remove_all(Node *&parent, Node *&temp) {
+template <typename Tk, typename Td, typename Aug>
+void Tree<Tk, Td, Aug>::remove_all(Node *&parent, Node *&temp) {
   Node *new_root = temp;
   parent = temp;
   temp = temp->right;
@@ -267,11 +755,11 @@ void Tree<Tk, Td>::remove_all(Node *&parent, Node *&temp) {
       parent->right = temp->right;
     }
   }
-  delete temp;
+  free_node(temp);
 }
 
-template <typename Tk, typename Td>
-bool Tree<Tk, Td>::remove(Tk key) {
+template <typename Tk, typename Td, typename Aug>
+bool Tree<Tk, Td, Aug>::remove(Tk key) {
   Node *temp = root, *parent = root;
   bool flag = false;
   find(temp, parent, key);
@@ -279,7 +767,7 @@ bool Tree<Tk, Td>::remove(Tk key) {
     flag = true;
     if (temp->left == nullptr && temp->right == nullptr) {
       if (temp == root) {
-        delete root;
+        free_node(root);
         root = nullptr;
       } else
         remove_no(temp->parent, temp);
@@ -288,30 +776,33 @@ bool Tree<Tk, Td>::remove(Tk key) {
     } else if (temp->left != nullptr) {
       if (temp == root) {
         root = temp->left;
-        delete temp;
+        root->parent = nullptr;
+        free_node(temp);
       } else
         remove_l(temp->parent, temp);
     } else if (temp->right != nullptr) {
       if (temp == root) {
         root = temp->right;
-        delete temp;
+        root->parent = nullptr;
+        free_node(temp);
       } else
         remove_r(temp->parent, temp);
     }
+    --size;
   }
   return flag;
 }
 
-template <typename Tk, typename Td>
-inline bool Tree<Tk, Td>::finder(Tk key) {
-  Node *node = Tree<Tk, Td>::root, *parent = nullptr;
+template <typename Tk, typename Td, typename Aug>
+inline bool Tree<Tk, Td, Aug>::finder(Tk key) {
+  Node *node = Tree<Tk, Td, Aug>::root, *parent = nullptr;
   find(node, parent, key);
   if (node) return true;
   return false;
 }
 
-template <typename Tk, typename Td>
-inline typename Tree<Tk, Td>::Node *Tree<Tk, Td>::search(Tk key) {
+template <typename Tk, typename Td, typename Aug>
+inline typename Tree<Tk, Td, Aug>::Node *Tree<Tk, Td, Aug>::search(Tk key) {
   Node *temp = root, *find = nullptr;
   while (temp != nullptr) {
     if (key == temp->key) {
@@ -327,30 +818,48 @@ inline typename Tree<Tk, Td>::Node *Tree<Tk, Td>::search(Tk key) {
   return find;
 }
 
-template <typename Tk, typename Td>
-inline typename Tree<Tk, Td>::Iterator Tree<Tk, Td>::find(Tk key) {
-  typename Tree<Tk, Td>::Iterator it = Tree<Tk, Td>::begin();
+template <typename Tk, typename Td, typename Aug>
+inline typename Tree<Tk, Td, Aug>::Iterator Tree<Tk, Td, Aug>::find(Tk key) {
+  typename Tree<Tk, Td, Aug>::Iterator it = Tree<Tk, Td, Aug>::begin();
   for (; it != end(); ++it)
     if ((*it).first == key) return it;
   return end();
 }
 
-template <typename Tk, typename Td>
-inline void Tree<Tk, Td>::swap(Tree &other) {
+template <typename Tk, typename Td, typename Aug>
+inline void Tree<Tk, Td, Aug>::swap(Tree &other) {
   std::swap(root, other.root);
+  std::swap(slab, other.slab);
+  std::swap(slab_capacity, other.slab_capacity);
+  std::swap(slab_live, other.slab_live);
   int temp = sizeofTree();
   set_size(other.sizeofTree());
   other.set_size(temp);
 }
 
-template <typename Tk, typename Td>
-inline void Tree<Tk, Td>::clear() {
-  while (root != nullptr) remove(root->key);
+template <typename Tk, typename Td, typename Aug>
+inline void Tree<Tk, Td, Aug>::clear() {
+  // Flattens left subtrees into the right spine while freeing, so the whole
+  // tree is released in one linear pass without recursion.
+  Node *cur = root;
+  while (cur != nullptr) {
+    if (cur->left != nullptr) {
+      Node *left = cur->left;
+      cur->left = left->right;
+      left->right = cur;
+      cur = left;
+    } else {
+      Node *next = cur->right;
+      release_node(cur);
+      cur = next;
+    }
+  }
+  root = nullptr;
   set_size(0);
 }
 
-template <typename Tk, typename Td>
-typename Tree<Tk, Td>::Iterator Tree<Tk, Td>::begin() {
+template <typename Tk, typename Td, typename Aug>
+typename Tree<Tk, Td, Aug>::Iterator Tree<Tk, Td, Aug>::begin() {
   if (root == nullptr) return end();
   Node *cur = root;
   while (cur->left != nullptr) {
@@ -360,13 +869,13 @@ typename Tree<Tk, Td>::Iterator Tree<Tk, Td>::begin() {
   return it;
 }
 
-template <typename Tk, typename Td>
-typename Tree<Tk, Td>::Iterator Tree<Tk, Td>::end() {
+template <typename Tk, typename Td, typename Aug>
+typename Tree<Tk, Td, Aug>::Iterator Tree<Tk, Td, Aug>::end() {
   return Iterator(this, nullptr);
 }
 
-template <typename Tk, typename Td>
-typename Tree<Tk, Td>::Node *Tree<Tk, Td>::max(Node *cur) {
+template <typename Tk, typename Td, typename Aug>
+typename Tree<Tk, Td, Aug>::Node *Tree<Tk, Td, Aug>::max(Node *cur) {
   if (cur == nullptr) return nullptr;
   while (cur->right != nullptr) {
     cur = cur->right;
@@ -374,8 +883,8 @@ typename Tree<Tk, Td>::Node *Tree<Tk, Td>::max(Node *cur) {
   return cur;
 }
 
-template <typename Tk, typename Td>
-typename Tree<Tk, Td>::Node *Tree<Tk, Td>::pred_add(Node *cur) {
+template <typename Tk, typename Td, typename Aug>
+typename Tree<Tk, Td, Aug>::Node *Tree<Tk, Td, Aug>::pred_add(Node *cur) {
   Node *predecessor = cur->parent;
   while (predecessor != nullptr && cur == predecessor->right) {
     cur = predecessor;
@@ -384,8 +893,8 @@ typename Tree<Tk, Td>::Node *Tree<Tk, Td>::pred_add(Node *cur) {
   return predecessor;
 }
 
-template <typename Tk, typename Td>
-typename Tree<Tk, Td>::Node *Tree<Tk, Td>::pred_sub(Node *cur) {
+template <typename Tk, typename Td, typename Aug>
+typename Tree<Tk, Td, Aug>::Node *Tree<Tk, Td, Aug>::pred_sub(Node *cur) {
   Node *predecessor = cur->parent;
   while (predecessor != nullptr && cur == predecessor->left) {
     cur = predecessor;
@@ -394,8 +903,8 @@ typename Tree<Tk, Td>::Node *Tree<Tk, Td>::pred_sub(Node *cur) {
   return predecessor;
 }
 
-template <typename Tk, typename Td>
-typename Tree<Tk, Td>::Node *Tree<Tk, Td>::predecessor(Node *cur) {
+template <typename Tk, typename Td, typename Aug>
+typename Tree<Tk, Td, Aug>::Node *Tree<Tk, Td, Aug>::predecessor(Node *cur) {
   if (cur == nullptr) return cur;
   if (cur->left != nullptr) {
     return max(cur->left);
@@ -403,15 +912,15 @@ typename Tree<Tk, Td>::Node *Tree<Tk, Td>::predecessor(Node *cur) {
     return pred_sub(cur);
 }
 
-template <typename Tk, typename Td>
-typename Tree<Tk, Td>::Node *Tree<Tk, Td>::min(Node *cur) {
+template <typename Tk, typename Td, typename Aug>
+typename Tree<Tk, Td, Aug>::Node *Tree<Tk, Td, Aug>::min(Node *cur) {
   if (cur == nullptr) return nullptr;
   while (cur->left != nullptr) cur = cur->left;
   return cur;
 }
 
-template <typename Tk, typename Td>
-typename Tree<Tk, Td>::Node *Tree<Tk, Td>::successor(Node *cur) {
+template <typename Tk, typename Td, typename Aug>
+typename Tree<Tk, Td, Aug>::Node *Tree<Tk, Td, Aug>::successor(Node *cur) {
   if (cur == nullptr) return cur;
   if (cur->right != nullptr)
     return min(cur->right);
@@ -419,46 +928,53 @@ typename Tree<Tk, Td>::Node *Tree<Tk, Td>::successor(Node *cur) {
     return pred_add(cur);
 }
 
-template <typename Tk, typename Td>
-inline int Tree<Tk, Td>::sizeofTree() const {
+template <typename Tk, typename Td, typename Aug>
+inline int Tree<Tk, Td, Aug>::sizeofTree() const {
   return (const int)this->size;
 }
 
-template <typename Tk, typename Td>
-inline bool Tree<Tk, Td>::isempty() {
+template <typename Tk, typename Td, typename Aug>
+inline bool Tree<Tk, Td, Aug>::isempty() {
   if (this->root != nullptr) return false;
   return true;
 }
 
-template <typename Tk, typename Td>
-inline typename Tree<Tk, Td>::value_type Tree<Tk, Td>::Iterator::operator*() {
+template <typename Tk, typename Td, typename Aug>
+inline typename Tree<Tk, Td, Aug>::value_type
+Tree<Tk, Td, Aug>::Iterator::operator*() {
   std::pair<const key_type, mapped_type> ret =
       std::make_pair(cur->key, cur->data);
   return ret;
 }
 
-template <typename Tk, typename Td>
-typename Tree<Tk, Td>::Iterator Tree<Tk, Td>::Iterator::operator--() {
-  cur = tree->predecessor(cur);
+template <typename Tk, typename Td, typename Aug>
+typename Tree<Tk, Td, Aug>::Iterator Tree<Tk, Td, Aug>::Iterator::operator--() {
+  if constexpr (kThreaded)
+    cur = cur == nullptr ? nullptr : cur->thread.prev;
+  else
+    cur = tree->predecessor(cur);
   return *this;
 }
 
-template <typename Tk, typename Td>
-typename Tree<Tk, Td>::Iterator Tree<Tk, Td>::Iterator::operator++() {
-  cur = tree->successor(cur);
+template <typename Tk, typename Td, typename Aug>
+typename Tree<Tk, Td, Aug>::Iterator Tree<Tk, Td, Aug>::Iterator::operator++() {
+  if constexpr (kThreaded)
+    cur = cur == nullptr ? nullptr : cur->thread.next;
+  else
+    cur = tree->successor(cur);
   return *this;
 }
 
-template <typename Tk, typename Td>
-inline bool Tree<Tk, Td>::Iterator::operator==(const Iterator &a) {
+template <typename Tk, typename Td, typename Aug>
+inline bool Tree<Tk, Td, Aug>::Iterator::operator==(const Iterator &a) {
   if (this->tree == a.tree && this->cur == a.cur)
     return true;
   else
     return false;
 }
 
-template <typename Tk, typename Td>
-inline bool Tree<Tk, Td>::Iterator::operator!=(const Iterator &a) {
+template <typename Tk, typename Td, typename Aug>
+inline bool Tree<Tk, Td, Aug>::Iterator::operator!=(const Iterator &a) {
   return !(*this == a);
 }
 
@@ -3,8 +3,8 @@
 #include "BSTree.h"
 
 namespace s21 {
-template <typename K, typename D>
-class RBTree : public s21::Tree<K, D> {
+template <typename K, typename D, typename Aug = no_augment>
+class RBTree : public s21::Tree<K, D, Aug> {
  public:
   using key_type = K;
   using mapped_type = D;
@@ -13,36 +13,87 @@ class RBTree : public s21::Tree<K, D> {
   using const_reference = const value_type &;
   using size_type = size_t;
 
-  RBTree() : Tree<K, D>(){};
+  RBTree() : Tree<K, D, Aug>(){};
   RBTree(const std::initializer_list<value_type> &items);
-  RBTree(const RBTree &m) : Tree<K, D>(m){};
-  RBTree(RBTree &&m) noexcept : Tree<K, D>(std::move(m)){};
+  RBTree(const RBTree &m) : Tree<K, D, Aug>(m){};
+  RBTree(RBTree &&m) noexcept : Tree<K, D, Aug>(std::move(m)){};
   ~RBTree() = default;
 
   void insert(K k, D d);
   void fixInsert(K key);
   void remove(K key);
 
+  typename Aug::value_type aggregate();
+  typename Aug::value_type aggregate(const K &lo, const K &hi);
+
   class Readwrite {};
 
  private:
-  typename Tree<K, D>::Node *rotateLeft(typename Tree<K, D>::Node *node);
-  typename Tree<K, D>::Node *rotateRight(typename Tree<K, D>::Node *node);
+  typename Tree<K, D, Aug>::Node *rotateLeft(
+      typename Tree<K, D, Aug>::Node *node);
+  typename Tree<K, D, Aug>::Node *rotateRight(
+      typename Tree<K, D, Aug>::Node *node);
 
-  typename Tree<K, D>::Node *remove(typename Tree<K, D>::Node *node, int key);
+  typename Tree<K, D, Aug>::Node *remove(
+      typename Tree<K, D, Aug>::Node *node, K key);
 };
 
-template <typename K, typename D>
-RBTree<K, D>::RBTree(const std::initializer_list<value_type> &items) {
-  Tree<K, D>::size = 0;
-  Tree<K, D>::root = nullptr;
+template <typename K, typename D, typename Aug>
+RBTree<K, D, Aug>::RBTree(const std::initializer_list<value_type> &items) {
+  Tree<K, D, Aug>::size = 0;
+  Tree<K, D, Aug>::root = nullptr;
   for (value_type i : items) insert(i.first, i.second);
 }
 
-template <typename K, typename D>
-inline typename Tree<K, D>::Node *RBTree<K, D>::rotateLeft(
-    typename Tree<K, D>::Node *node) {
-  typename Tree<K, D>::Node *right = node->right;
+template <typename K, typename D, typename Aug>
+inline typename Aug::value_type RBTree<K, D, Aug>::aggregate() {
+  typename Tree<K, D, Aug>::Node *root = Tree<K, D, Aug>::root;
+  return root == nullptr ? Aug::identity() : root->aug;
+}
+
+// Folds the elements with keys in [lo, hi] in key order. Below the node
+// where the paths to lo and hi split, the left path contributes the nodes
+// not smaller than lo together with their right subtrees, and the right path
+// the nodes not greater than hi together with their left subtrees. Values
+// changed through references returned by the container are not seen until
+// the node is updated through insert_or_assign.
+template <typename K, typename D, typename Aug>
+typename Aug::value_type RBTree<K, D, Aug>::aggregate(const K &lo,
+                                                      const K &hi) {
+  typename Tree<K, D, Aug>::Node *split = Tree<K, D, Aug>::root;
+  while (split != nullptr && (split->key < lo || hi < split->key))
+    split = split->key < lo ? split->right : split->left;
+  if (split == nullptr) return Aug::identity();
+
+  typename Aug::value_type left = Aug::identity();
+  for (auto *node = split->left; node != nullptr;) {
+    if (node->key < lo) {
+      node = node->right;
+    } else {
+      typename Aug::value_type part = Aug::lift(node);
+      if (node->right != nullptr) part = Aug::combine(part, node->right->aug);
+      left = Aug::combine(part, left);
+      node = node->left;
+    }
+  }
+  typename Aug::value_type right = Aug::identity();
+  for (auto *node = split->right; node != nullptr;) {
+    if (hi < node->key) {
+      node = node->left;
+    } else {
+      typename Aug::value_type part = Aug::lift(node);
+      if (node->left != nullptr) part = Aug::combine(node->left->aug, part);
+      right = Aug::combine(right, part);
+      node = node->right;
+    }
+  }
+  return Aug::combine(Aug::combine(left, Aug::lift(split)), right);
+}
+
+template <typename K, typename D, typename Aug>
+inline typename Tree<K, D, Aug>::Node *RBTree<K, D, Aug>::rotateLeft(
+    typename Tree<K, D, Aug>::Node *node) {
+  typename Tree<K, D, Aug>::Node *right = node->right;
   if (right == nullptr) return node;
   node->right = right->left;
   if (right->left != nullptr) {
@@ -50,7 +101,7 @@ inline typename Tree<K, D>::Node *RBTree<K, D>::rotateLeft(
   }
   right->parent = node->parent;
   if (node->parent == nullptr) {
-    Tree<K, D>::root = right;
+    Tree<K, D, Aug>::root = right;
   } else if (node == node->parent->left) {
     node->parent->left = right;
   } else {
@@ -60,13 +111,15 @@ inline typename Tree<K, D>::Node *RBTree<K, D>::rotateLeft(
   node->parent = right;
   right->isRed = node->isRed;
   node->isRed = true;
+  Aug::update(node);
+  Aug::update(right);
   return right;
 }
 
-template <typename K, typename D>
-inline typename Tree<K, D>::Node *RBTree<K, D>::rotateRight(
-    typename Tree<K, D>::Node *node) {
-  typename Tree<K, D>::Node *left = node->left;
+template <typename K, typename D, typename Aug>
+inline typename Tree<K, D, Aug>::Node *RBTree<K, D, Aug>::rotateRight(
+    typename Tree<K, D, Aug>::Node *node) {
+  typename Tree<K, D, Aug>::Node *left = node->left;
   if (left == nullptr) return node;
   node->left = left->right;
   if (left->right != nullptr) {
@@ -74,7 +127,7 @@ inline typename Tree<K, D>::Node *RBTree<K, D>::rotateRight(
   }
   left->parent = node->parent;
   if (node->parent == nullptr) {
-    Tree<K, D>::root = left;
+    Tree<K, D, Aug>::root = left;
   } else if (node == node->parent->left) {
     node->parent->left = left;
   } else {
@@ -84,23 +137,26 @@ inline typename Tree<K, D>::Node *RBTree<K, D>::rotateRight(
   node->parent = left;
   left->isRed = node->isRed;
   node->isRed = true;
+  Aug::update(node);
+  Aug::update(left);
   return left;
 }
 
-template <typename K, typename D>
-inline void RBTree<K, D>::insert(K k, D d) {
-  Tree<K, D>::insert(k, d);
+template <typename K, typename D, typename Aug>
+inline void RBTree<K, D, Aug>::insert(K k, D d) {
+  Tree<K, D, Aug>::insert(k, d);
   fixInsert(k);
 }
 
-template <typename K, typename D>
-inline void RBTree<K, D>::fixInsert(K key) {
-  typename Tree<K, D>::Node *node = Tree<K, D>::root, *parent = nullptr;
-  Tree<K, D>::find(node, parent, key);
-  while (node->isRed == true && node != Tree<K, D>::root &&
+template <typename K, typename D, typename Aug>
+inline void RBTree<K, D, Aug>::fixInsert(K key) {
+  typename Tree<K, D, Aug>::Node *node = Tree<K, D, Aug>::root,
+                                 *parent = nullptr;
+  Tree<K, D, Aug>::find(node, parent, key);
+  while (node->isRed == true && node != Tree<K, D, Aug>::root &&
          node->parent->isRed == true) {
     if (node->parent == node->parent->parent->left) {
-      typename Tree<K, D>::Node *uncle = nullptr;
+      typename Tree<K, D, Aug>::Node *uncle = nullptr;
       if (node->parent->parent) uncle = node->parent->parent->right;
       if (uncle != nullptr && uncle->isRed == true) {
         node->parent->isRed = false;
@@ -114,16 +170,16 @@ inline void RBTree<K, D>::fixInsert(K key) {
         }
         node->parent->isRed = false;
         if (node->parent->parent != nullptr) node->parent->parent->isRed = true;
-        if (node->parent->parent == Tree<K, D>::root) {
+        if (node->parent->parent == Tree<K, D, Aug>::root) {
           node = rotateRight(node->parent->parent);
-          Tree<K, D>::root = node;
-        } else if (node->parent != Tree<K, D>::root)
+          Tree<K, D, Aug>::root = node;
+        } else if (node->parent != Tree<K, D, Aug>::root)
           node = rotateRight(node->parent->parent);
         else
           node = rotateRight(node->parent);
       }
     } else {
-      typename Tree<K, D>::Node *uncle = nullptr;
+      typename Tree<K, D, Aug>::Node *uncle = nullptr;
       if (node->parent->parent) uncle = node->parent->parent->left;
       if (uncle != nullptr && uncle->isRed == true) {
         node->parent->isRed = false;
@@ -137,41 +193,41 @@ inline void RBTree<K, D>::fixInsert(K key) {
         }
         node->parent->isRed = false;
         if (node->parent->parent) node->parent->parent->isRed = true;
-        if (node->parent->parent == Tree<K, D>::root) {
+        if (node->parent->parent == Tree<K, D, Aug>::root) {
           node = rotateLeft(node->parent->parent);
-          Tree<K, D>::root = node;
-        } else if (node->parent != Tree<K, D>::root)
+          Tree<K, D, Aug>::root = node;
+        } else if (node->parent != Tree<K, D, Aug>::root)
           node = rotateLeft(node->parent->parent);
         else
           node = rotateLeft(node->parent);
       }
     }
   }
-  Tree<K, D>::root->isRed = false;
+  Tree<K, D, Aug>::root->isRed = false;
 }
 
-template <typename K, typename D>
-inline void RBTree<K, D>::remove(K key) {
-  typename Tree<K, D>::Node *node = Tree<K, D>::root;
+template <typename K, typename D, typename Aug>
+inline void RBTree<K, D, Aug>::remove(K key) {
+  typename Tree<K, D, Aug>::Node *node = Tree<K, D, Aug>::root;
   remove(node, key);
 }
 
-template <typename K, typename D>
-inline typename Tree<K, D>::Node *RBTree<K, D>::remove(
-    typename Tree<K, D>::Node *node, int key) {
-  typename Tree<K, D>::Node *parent = nullptr;
-  Tree<K, D>::find(node, parent, key);
+template <typename K, typename D, typename Aug>
+inline typename Tree<K, D, Aug>::Node *RBTree<K, D, Aug>::remove(
+    typename Tree<K, D, Aug>::Node *node, K key) {
+  typename Tree<K, D, Aug>::Node *parent = nullptr;
+  Tree<K, D, Aug>::find(node, parent, key);
   if (node == nullptr) {
     return nullptr;
   }
   if (node->left == nullptr || node->right == nullptr) {
-    typename Tree<K, D>::Node *child =
+    typename Tree<K, D, Aug>::Node *child =
         node->left != nullptr ? node->left : node->right;
     if (child != nullptr) {
       child->parent = node->parent;
     }
     if (node->parent == nullptr) {
-      Tree<K, D>::root = child;
+      Tree<K, D, Aug>::root = child;
     } else if (node == node->parent->left) {
       node->parent->left = child;
     } else {
@@ -180,12 +236,13 @@ inline typename Tree<K, D>::Node *RBTree<K, D>::remove(
     if (child != nullptr && node->isRed == false && child->isRed == true) {
       child->isRed = false;
     }
-    delete node;
-    Tree<K, D>::set_size(Tree<K, D>::sizeofTree() - 1);
+    Tree<K, D, Aug>::refresh_path(node->parent);
+    Tree<K, D, Aug>::free_node(node);
+    Tree<K, D, Aug>::set_size(Tree<K, D, Aug>::sizeofTree() - 1);
     return child;
 
   } else {
-    typename Tree<K, D>::Node *minRight = node->right;
+    typename Tree<K, D, Aug>::Node *minRight = node->right;
     while (minRight->left != nullptr) {
       minRight = minRight->left;
     }
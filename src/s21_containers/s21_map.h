@@ -9,8 +9,8 @@
 #include "s21_vector.h"
 
 namespace s21 {
-template <typename Key, typename T>
-class map : public RBTree<Key, T> {
+template <typename Key, typename T, typename Aug = no_augment>
+class map : public RBTree<Key, T, Aug> {
  public:
   using key_type = Key;
   using mapped_type = T;
@@ -18,15 +18,16 @@ class map : public RBTree<Key, T> {
   using reference = value_type &;
   using const_reference = const value_type &;
   using size_type = size_t;
-  using iterator = typename Tree<Key, T>::Iterator;
-  using const_iterator = typename Tree<Key, T>::ConstIterator;
+  using iterator = typename Tree<Key, T, Aug>::Iterator;
+  using const_iterator = typename Tree<Key, T, Aug>::ConstIterator;
 
-  map() : RBTree<key_type, mapped_type>(){};
+  map() : RBTree<key_type, mapped_type, Aug>(){};
   map(std::initializer_list<
-      typename RBTree<key_type, mapped_type>::value_type> const &items)
-      : RBTree<key_type, mapped_type>(items){};
-  map(const map &m) : RBTree<key_type, mapped_type>(m){};
-  map(map &&m) noexcept : RBTree<key_type, mapped_type>(std::move(m)){};
+      typename RBTree<key_type, mapped_type, Aug>::value_type> const &items)
+      : RBTree<key_type, mapped_type, Aug>(items){};
+  explicit map(s21::vector<std::pair<key_type, mapped_type>> items);
+  map(const map &m) : RBTree<key_type, mapped_type, Aug>(m){};
+  map(map &&m) noexcept : RBTree<key_type, mapped_type, Aug>(std::move(m)){};
   ~map() = default;
   map &operator=(map &&other) noexcept;
   map &operator=(const map &other);
@@ -54,17 +55,19 @@ class map : public RBTree<Key, T> {
   s21::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
 };
 
-template <typename Key, typename T>
-inline map<Key, T> &map<Key, T>::operator=(map &&other) noexcept {
-  if (this != &other) {
-    Tree<Key, Key>::root = other.root;
-    other.root = nullptr;
-  }
+template <typename Key, typename T, typename Aug>
+map<Key, T, Aug>::map(s21::vector<std::pair<key_type, mapped_type>> items) {
+  Tree<Key, T, Aug>::BuildTree(items);
+}
+
+template <typename Key, typename T, typename Aug>
+inline map<Key, T, Aug> &map<Key, T, Aug>::operator=(map &&other) noexcept {
+  Tree<Key, T, Aug>::operator=(std::move(other));
   return *this;
 }
 
-template <typename Key, typename T>
-inline map<Key, T> &map<Key, T>::operator=(const map &other) {
+template <typename Key, typename T, typename Aug>
+inline map<Key, T, Aug> &map<Key, T, Aug>::operator=(const map &other) {
   if (this != &other) {
     map temp(other);
     clear();
@@ -73,102 +76,103 @@ inline map<Key, T> &map<Key, T>::operator=(const map &other) {
   return *this;
 }
 
-template <typename Key, typename T>
-inline T &map<Key, T>::at(const Key &key) {
+template <typename Key, typename T, typename Aug>
+inline T &map<Key, T, Aug>::at(const Key &key) {
   Key k = key;
   Key &ref = k;
   if (contains(key))
-    return Tree<Key, T>::search(ref)->data;
+    return Tree<Key, T, Aug>::search(ref)->data;
   else
-    throw typename RBTree<Key, T>::Readwrite{};
+    throw typename RBTree<Key, T, Aug>::Readwrite{};
 }
 
-template <typename Key, typename T>
-inline T &map<Key, T>::operator[](const Key &key) {
+template <typename Key, typename T, typename Aug>
+inline T &map<Key, T, Aug>::operator[](const Key &key) {
   Key k = key;
   Key &ref = k;
   if (contains(key)) {
-    return Tree<Key, T>::search(ref)->data;
+    return Tree<Key, T, Aug>::search(ref)->data;
   } else
-    throw typename RBTree<Key, T>::Readwrite{};
+    throw typename RBTree<Key, T, Aug>::Readwrite{};
 }
 
-template <typename Key, typename T>
-inline bool map<Key, T>::empty() {
-  return Tree<Key, T>::isempty();
+template <typename Key, typename T, typename Aug>
+inline bool map<Key, T, Aug>::empty() {
+  return Tree<Key, T, Aug>::isempty();
 }
 
-template <typename Key, typename T>
-inline typename map<Key, T>::size_type map<Key, T>::size() {
-  return Tree<Key, T>::sizeofTree();
+template <typename Key, typename T, typename Aug>
+inline typename map<Key, T, Aug>::size_type map<Key, T, Aug>::size() {
+  return Tree<Key, T, Aug>::sizeofTree();
 }
 
-template <typename Key, typename T>
-inline typename map<Key, T>::size_type map<Key, T>::max_size() noexcept {
-  return std::numeric_limits<typename map<Key, T>::size_type>::max() /
-         sizeof(map<Key, T>);
+template <typename Key, typename T, typename Aug>
+inline typename map<Key, T, Aug>::size_type
+map<Key, T, Aug>::max_size() noexcept {
+  return std::numeric_limits<typename map<Key, T, Aug>::size_type>::max() /
+         sizeof(map<Key, T, Aug>);
 }
 
-template <typename Key, typename T>
-inline bool map<Key, T>::contains(const Key &key) {
-  return s21::Tree<Key, T>::finder(key);
+template <typename Key, typename T, typename Aug>
+inline bool map<Key, T, Aug>::contains(const Key &key) {
+  return s21::Tree<Key, T, Aug>::finder(key);
 }
 
-template <typename Key, typename T>
-inline void map<Key, T>::clear() {
-  Tree<Key, T>::clear();
+template <typename Key, typename T, typename Aug>
+inline void map<Key, T, Aug>::clear() {
+  Tree<Key, T, Aug>::clear();
 }
 
-template <typename Key, typename T>
-inline std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const typename map<Key, T>::value_type &value) {
-  return map<Key, T>::insert(value.first, value.second);
+template <typename Key, typename T, typename Aug>
+inline std::pair<typename map<Key, T, Aug>::iterator, bool>
+map<Key, T, Aug>::insert(const typename map<Key, T, Aug>::value_type &value) {
+  return map<Key, T, Aug>::insert(value.first, value.second);
 }
 
-template <typename Key, typename T>
-inline std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const Key &key, const T &obj) {
-  std::pair<typename map<Key, T>::iterator, bool> ret;
+template <typename Key, typename T, typename Aug>
+inline std::pair<typename map<Key, T, Aug>::iterator, bool>
+map<Key, T, Aug>::insert(const Key &key, const T &obj) {
+  std::pair<typename map<Key, T, Aug>::iterator, bool> ret;
   if (contains(key)) {
-    ret = std::make_pair(Tree<Key, T>::end(), false);
+    ret = std::make_pair(Tree<Key, T, Aug>::end(), false);
     return ret;
   }
-  s21::Tree<Key, T>::insert(key, obj);
-  s21::RBTree<Key, T>::fixInsert(key);
-  ret = std::make_pair(s21::Tree<Key, T>::findIter(key), true);
+  s21::Tree<Key, T, Aug>::insert(key, obj);
+  s21::RBTree<Key, T, Aug>::fixInsert(key);
+  ret = std::make_pair(s21::Tree<Key, T, Aug>::findIter(key), true);
   return ret;
 }
 
-template <typename Key, typename T>
-inline std::pair<typename map<Key, T>::iterator, bool>
-map<Key, T>::insert_or_assign(const Key &key, const T &obj) {
+template <typename Key, typename T, typename Aug>
+inline std::pair<typename map<Key, T, Aug>::iterator, bool>
+map<Key, T, Aug>::insert_or_assign(const Key &key, const T &obj) {
   if (contains(key)) {
-    Tree<Key, T>::replace(key, obj);
-    s21::RBTree<Key, T>::fixInsert(key);
-    auto aboba = s21::Tree<Key, T>::findIter(key);
+    Tree<Key, T, Aug>::replace(key, obj);
+    s21::RBTree<Key, T, Aug>::fixInsert(key);
+    auto aboba = s21::Tree<Key, T, Aug>::findIter(key);
     auto ret = std::make_pair(aboba, false);
     return ret;
   }
-  Tree<Key, T>::insert(key, obj);
-  RBTree<Key, T>::fixInsert(key);
-  return std::make_pair(s21::Tree<Key, T>::findIter(key), true);
+  Tree<Key, T, Aug>::insert(key, obj);
+  RBTree<Key, T, Aug>::fixInsert(key);
+  return std::make_pair(s21::Tree<Key, T, Aug>::findIter(key), true);
 }
 
-template <typename Key, typename T>
-inline void map<Key, T>::erase(typename map<Key, T>::iterator pos) {
+template <typename Key, typename T, typename Aug>
+inline void map<Key, T, Aug>::erase(typename map<Key, T, Aug>::iterator pos) {
   std::pair<const Key, T> ret = *pos;
-  RBTree<Key, T>::remove(ret.first);
+  RBTree<Key, T, Aug>::remove(ret.first);
 }
 
-template <typename Key, typename T>
-inline void map<Key, T>::swap(map &other) {
-  Tree<Key, T>::swap(other);
+template <typename Key, typename T, typename Aug>
+inline void map<Key, T, Aug>::swap(map &other) {
+  Tree<Key, T, Aug>::swap(other);
 }
 
-template <typename Key, typename T>
-inline void map<Key, T>::merge(map &other) {
-  typename map<Key, T>::iterator pos = other.Tree<Key, T>::begin();
-  for (auto it = pos; it != other.Tree<Key, T>::end();) {
+template <typename Key, typename T, typename Aug>
+inline void map<Key, T, Aug>::merge(map &other) {
+  typename map<Key, T, Aug>::iterator pos = other.Tree<Key, T, Aug>::begin();
+  for (auto it = pos; it != other.Tree<Key, T, Aug>::end();) {
     if (insert((*it).first, (*it).second).second) {
       auto temp_it = it;
       ++it;
@@ -178,10 +182,10 @@ inline void map<Key, T>::merge(map &other) {
   }
 }
 
-template <typename Key, typename T>
+template <typename Key, typename T, typename Aug>
 template <typename... Args>
-inline s21::vector<std::pair<typename map<Key, T>::iterator, bool>>
-map<Key, T>::insert_many(Args &&...args) {
+inline s21::vector<std::pair<typename map<Key, T, Aug>::iterator, bool>>
+map<Key, T, Aug>::insert_many(Args &&...args) {
   return {insert(std::forward<Args>(args))...};
 }
 
@@ -53,10 +53,7 @@ set<Key>::set(const typename std::initializer_list<value_type> &items) {
 
 template <typename Key>
 inline set<Key> &set<Key>::operator=(set &&other) noexcept {
-  if (this != &other) {
-    Tree<Key, Key>::root = other.root;
-    other.root = nullptr;
-  }
+  Tree<Key, Key>::operator=(std::move(other));
   return *this;
 }
 
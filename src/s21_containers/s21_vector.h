@@ -1,10 +1,79 @@
 #ifndef S21_CONTAINERS_S21_VECTOR_H
 #define S21_CONTAINERS_S21_VECTOR_H
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#endif
 
 namespace s21 {
-template <typename T, typename Alloc = std::allocator<T>>
+// Growth policies pick the new capacity when a vector of `size` elements has
+// to hold `required` ones. The vector never asks for less than `required`.
+
+// Doubles the size like std::vector. This is the default.
+struct double_growth {
+  static size_t next(size_t size, size_t required) {
+    return (size > required - size ? size * 2 : required);
+  }
+};
+
+// Grows by half, which uses less memory and lets the allocator reuse the
+// blocks freed by earlier growth steps.
+struct half_growth {
+  static size_t next(size_t size, size_t required) {
+    size_t grown = size + size / 2;
+    return (grown > required ? grown : required);
+  }
+};
+
+// Adds whole chunks of Chunk elements, for vectors that grow by a known
+// step and must not overshoot it.
+template <size_t Chunk>
+struct chunk_growth {
+  static_assert(Chunk > 0, "Chunk must not be zero");
+  static size_t next(size_t, size_t required) {
+    return (required + Chunk - 1) / Chunk * Chunk;
+  }
+};
+
+// Wraps another policy and lets the vector use the whole block the
+// allocator returned. Only buffers that come from malloc can be measured, on
+// glibc and macOS; other vectors keep the capacity they asked for.
+template <typename Growth>
+struct block_rounded : Growth {
+  static constexpr bool round_to_block = true;
+};
+
+template <typename Growth, typename = void>
+struct rounds_to_block : std::false_type {};
+
+template <typename Growth>
+struct rounds_to_block<Growth, std::void_t<decltype(Growth::round_to_block)>>
+    : std::bool_constant<Growth::round_to_block> {};
+
+// Selects the constructor and resize that default-initialise new elements:
+// trivially constructible ones keep whatever bytes the buffer held, for a
+// buffer that a read() or a decoder is about to overwrite anyway.
+struct default_init_t {
+  explicit default_init_t() = default;
+};
+inline constexpr default_init_t default_init{};
+
+template <typename T, typename Alloc = std::allocator<T>,
+          typename Growth = double_growth>
 class vector {
  public:
   using value_type = T;
@@ -13,20 +82,39 @@ class vector {
   using iterator = T *;
   using const_iterator = const T *;
   using size_type = size_t;
+  using allocator_type = Alloc;
   using alloc_traits = std::allocator_traits<Alloc>;
 
-  vector();
-  explicit vector(size_type n);
-  vector(std::initializer_list<value_type> const &items);
+  // Keeps the iterator-range overloads away from calls such as
+  // insert(pos, 5, 7), where both arguments are integers.
+  template <typename InputIt>
+  using require_input_iterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<InputIt>::iterator_category,
+      std::input_iterator_tag>>;
+
+  vector() noexcept(noexcept(Alloc()));
+  explicit vector(const Alloc &alloc) noexcept;
+  explicit vector(size_type n, const Alloc &alloc = Alloc());
+  vector(size_type n, default_init_t, const Alloc &alloc = Alloc());
+  vector(std::initializer_list<value_type> const &items,
+         const Alloc &alloc = Alloc());
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  vector(InputIt first, InputIt last, const Alloc &alloc = Alloc());
   vector(const vector &v);
-  vector(vector &&v) noexcept(alloc_traits::propagate_on_container_swap::value);
+  vector(const vector &v, const Alloc &alloc);
+  vector(vector &&v) noexcept;
+  vector(vector &&v, const Alloc &alloc);
   ~vector();
 
   vector &operator=(const vector &v);
   vector &operator=(vector &&v) noexcept(
-      alloc_traits::propagate_on_container_move_assignment::value);
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value);
   vector &operator=(std::initializer_list<value_type> const &items);
 
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  void assign(InputIt first, InputIt last);
+
   reference at(size_type pos);
   const_reference at(size_type pos) const;
 
@@ -54,14 +142,33 @@ class vector {
   void shrink_to_fit();
 
   void clear();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
+  void resize_for_overwrite(size_type count);
   iterator insert(const_iterator pos, const_reference value);
   iterator insert(const_iterator pos, T &&value);
   iterator insert(const_iterator pos, size_type count, const T &value);
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  template <typename Range>
+  void append_range(Range &&range);
   iterator erase(iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  iterator swap_and_pop(iterator pos);
   void push_back(const_reference value);
+  void push_back(T &&value);
   void pop_back();
   void swap(vector &other) noexcept(
-      alloc_traits::propagate_on_container_swap::value);
+      alloc_traits::propagate_on_container_swap::value ||
+      alloc_traits::is_always_equal::value);
+
+  allocator_type get_allocator() const;
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
 
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args);
@@ -70,34 +177,69 @@ class vector {
   void insert_many_back(Args &&...args);
 
  private:
+  // Trivially copyable elements are relocated with memcpy/memmove instead of
+  // per-element construct/destroy loops. With the default allocator their
+  // buffer also comes from malloc, so growing it can use realloc.
+  static constexpr bool kTrivial = std::is_trivially_copyable_v<T>;
+  static constexpr bool kUseMalloc =
+      kTrivial && std::is_same_v<Alloc, std::allocator<T>> &&
+      alignof(T) <= alignof(std::max_align_t);
+#if defined(__GLIBC__) || defined(__APPLE__)
+  static constexpr bool kRoundToBlock =
+      kUseMalloc && rounds_to_block<Growth>::value;
+#else
+  static constexpr bool kRoundToBlock = false;
+#endif
+
   iterator data_;
   size_type size_;
   size_type capacity_;
   Alloc alloc_;
 
+  iterator allocate_data(size_type n);
+  void deallocate_data(iterator data, size_type n);
+  void reallocate_data(size_type new_capacity);
   void destroy_data();
-  void init_value_type_for_insert(size_type length);
-  void add_value_in_back(iterator cur_data, const_reference value);
+  size_type block_capacity(iterator data, size_type n) const;
+  size_type grow_capacity(size_type count) const;
+  void open_gap(size_type iter_pos, size_type count);
+  template <bool ValueInit>
+  void append_initialized(size_type count);
+  void close_gap(size_type iter_pos, size_type count, size_type built);
+  template <typename ForwardIt>
+  void construct_in_gap(size_type iter_pos, ForwardIt first, size_type count);
   void copy_in_data(const iterator other_data);
   void copy_from_data(iterator new_data);
+  void steal_data(vector &other) noexcept;
 };
 
-template <typename T, typename Alloc>
-inline vector<T, Alloc>::vector()
-    : data_(nullptr), size_(0), capacity_(0), alloc_() {}
+template <typename T, typename Alloc, typename Growth>
+inline vector<T, Alloc, Growth>::vector() noexcept(noexcept(Alloc()))
+    : vector(Alloc()) {}
+
+template <typename T, typename Alloc, typename Growth>
+inline vector<T, Alloc, Growth>::vector(const Alloc &alloc) noexcept
+    : data_(nullptr), size_(0), capacity_(0), alloc_(alloc) {}
 
-template <typename T, typename Alloc>
-inline vector<T, Alloc>::vector(size_type n) : size_(n), capacity_(n) {
+template <typename T, typename Alloc, typename Growth>
+inline vector<T, Alloc, Growth>::vector(size_type n, const Alloc &alloc)
+    : size_(n), capacity_(n), alloc_(alloc) {
   if (n > 0) {
-    data_ = alloc_traits::allocate(alloc_, size_);
+    data_ = allocate_data(size_);
+    // Numbers value-initialise to zero bytes, which memset writes a vector
+    // register at a time.
+    if constexpr (kUseMalloc && std::is_arithmetic_v<T>) {
+      std::memset(static_cast<void *>(data_), 0, n * sizeof(value_type));
+      return;
+    }
     for (size_type i = 0; i < size_; ++i) {
       try {
-        alloc_traits::construct(alloc_, data_ + i, value_type(value_type()));
+        alloc_traits::construct(alloc_, data_ + i);
       } catch (...) {
         for (size_type j = 0; j < i; ++j) {
           alloc_traits::destroy(alloc_, data_ + j);
         }
-        alloc_traits::deallocate(alloc_, data_, size_);
+        deallocate_data(data_, size_);
         throw;
       }
     }
@@ -106,36 +248,63 @@ inline vector<T, Alloc>::vector(size_type n) : size_(n), capacity_(n) {
   }
 }
 
-template <typename T, typename Alloc>
-inline vector<T, Alloc>::vector(std::initializer_list<value_type> const &items)
-    : vector(items.size()) {
-  std::copy(items.begin(), items.end(), data_);
+template <typename T, typename Alloc, typename Growth>
+inline vector<T, Alloc, Growth>::vector(size_type n, default_init_t,
+                                        const Alloc &alloc)
+    : vector(alloc) {
+  reserve(n);
+  append_initialized<false>(n);
 }
 
-template <typename T, typename Alloc>
-inline vector<T, Alloc>::vector(const vector &v)
-    : size_(v.size_), capacity_(v.capacity_) {
-  if (v.empty()) {
-    data_ = nullptr;
-  } else {
+template <typename T, typename Alloc, typename Growth>
+inline vector<T, Alloc, Growth>::vector(
+    std::initializer_list<value_type> const &items, const Alloc &alloc)
+    : vector(items.begin(), items.end(), alloc) {}
+
+template <typename T, typename Alloc, typename Growth>
+template <typename InputIt, typename>
+inline vector<T, Alloc, Growth>::vector(InputIt first, InputIt last,
+                                        const Alloc &alloc)
+    : vector(alloc) {
+  insert(end(), first, last);
+}
+
+// The allocator of a copy is chosen by the allocator itself, so an arena
+// allocator can decide whether copies stay in its arena.
+template <typename T, typename Alloc, typename Growth>
+inline vector<T, Alloc, Growth>::vector(const vector &v)
+    : vector(v, alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+}
+
+template <typename T, typename Alloc, typename Growth>
+inline vector<T, Alloc, Growth>::vector(const vector &v, const Alloc &alloc)
+    : data_(nullptr), size_(v.size_), capacity_(v.capacity_), alloc_(alloc) {
+  if (capacity_ > 0) {
     copy_in_data(v.data_);
   }
 }
 
-template <typename T, typename Alloc>
-inline vector<T, Alloc>::vector(vector &&v) noexcept(
-    alloc_traits::propagate_on_container_swap::value)
-    : vector() {
-  if (this != &v) {
-    std::swap(size_, v.size_);
-    std::swap(capacity_, v.capacity_);
-    std::swap(alloc_, v.alloc_);
-    std::swap(data_, v.data_);
+template <typename T, typename Alloc, typename Growth>
+inline vector<T, Alloc, Growth>::vector(vector &&v) noexcept
+    : data_(nullptr), size_(0), capacity_(0), alloc_(std::move(v.alloc_)) {
+  steal_data(v);
+}
+
+// Memory of another allocator cannot be taken over, so then the elements
+// are moved one by one.
+template <typename T, typename Alloc, typename Growth>
+inline vector<T, Alloc, Growth>::vector(vector &&v, const Alloc &alloc)
+    : vector(alloc) {
+  if (alloc_traits::is_always_equal::value || alloc_ == v.alloc_) {
+    steal_data(v);
+  } else {
+    assign(std::make_move_iterator(v.begin()),
+           std::make_move_iterator(v.end()));
   }
 }
 
-template <typename T, typename Alloc>
-inline vector<T, Alloc>::~vector() {
+template <typename T, typename Alloc, typename Growth>
+inline vector<T, Alloc, Growth>::~vector() {
   destroy_data();
 
   data_ = nullptr;
@@ -143,135 +312,161 @@ inline vector<T, Alloc>::~vector() {
   capacity_ = 0;
 }
 
-template <typename T, typename Alloc>
-inline vector<T, Alloc> &vector<T, Alloc>::operator=(const vector &v) {
+template <typename T, typename Alloc, typename Growth>
+inline vector<T, Alloc, Growth> &vector<T, Alloc, Growth>::operator=(
+    const vector &v) {
   if (this != &v) {
-    if (!empty()) {
-      destroy_data();
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                      value) {
+      if (!alloc_traits::is_always_equal::value && alloc_ != v.alloc_) {
+        destroy_data();
+        data_ = nullptr;
+        size_ = 0;
+        capacity_ = 0;
+      }
+      alloc_ = v.alloc_;
     }
-
-    size_ = v.size_;
-    capacity_ = v.capacity_;
-
-    copy_in_data(v.data_);
+    assign(v.begin(), v.end());
   }
   return *this;
 }
 
-template <typename T, typename Alloc>
-inline vector<T, Alloc> &vector<T, Alloc>::operator=(vector &&v) noexcept(
-    alloc_traits::propagate_on_container_move_assignment::value) {
-  if (this != &v) {
-    if (!empty()) {
+template <typename T, typename Alloc, typename Growth>
+inline vector<T, Alloc, Growth> &vector<T, Alloc, Growth>::operator=(
+    vector &&v) noexcept(alloc_traits::propagate_on_container_move_assignment::
+                             value ||
+                         alloc_traits::is_always_equal::value) {
+  if (this == &v) return *this;
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    destroy_data();
+    alloc_ = std::move(v.alloc_);
+    steal_data(v);
+  } else {
+    if (alloc_traits::is_always_equal::value || alloc_ == v.alloc_) {
       destroy_data();
+      steal_data(v);
+    } else {
+      assign(std::make_move_iterator(v.begin()),
+             std::make_move_iterator(v.end()));
     }
-
-    alloc_ = std::move(v.alloc_);
-    data_ = std::move(v.data_);
-    size_ = v.size_;
-    capacity_ = v.capacity_;
-
-    v.size_ = 0;
-    v.capacity_ = 0;
-    v.data_ = nullptr;
   }
   return *this;
 }
 
-template <typename T, typename Alloc>
-inline vector<T, Alloc> &vector<T, Alloc>::operator=(
+template <typename T, typename Alloc, typename Growth>
+inline vector<T, Alloc, Growth> &vector<T, Alloc, Growth>::operator=(
     std::initializer_list<value_type> const &items) {
-  if (!empty() && items.size() > capacity_) {
-    destroy_data();
-    data_ = alloc_traits::allocate(alloc_, items.size());
-    capacity_ = items.size();
-  } else if (!empty() && items.size() <= capacity_) {
-    clear();
-  }
-
-  size_ = items.size();
-  std::uninitialized_copy(items.begin(), items.end(), data_);
-
+  assign(items.begin(), items.end());
   return *this;
 }
 
-template <typename T, typename Alloc>
-inline typename vector<T, Alloc>::reference vector<T, Alloc>::at(
-    size_type pos) {
+// A forward range is measured first, so the buffer is replaced at most once
+// and only when the current one is too small.
+template <typename T, typename Alloc, typename Growth>
+template <typename InputIt, typename>
+void vector<T, Alloc, Growth>::assign(InputIt first, InputIt last) {
+  clear();
+  if constexpr (std::is_convertible_v<
+                    typename std::iterator_traits<InputIt>::iterator_category,
+                    std::forward_iterator_tag>) {
+    size_type count = std::distance(first, last);
+    if (count > capacity_) {
+      if (count > max_size()) {
+        throw std::length_error("Vector is too long");
+      }
+      iterator new_data = allocate_data(count);
+      deallocate_data(data_, capacity_);
+      data_ = new_data;
+      capacity_ = block_capacity(new_data, count);
+    }
+    construct_in_gap(0, first, count);
+  } else {
+    for (; first != last; ++first) emplace_back(*first);
+  }
+}
+
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::reference
+vector<T, Alloc, Growth>::at(size_type pos) {
   return (pos >= size() ? throw std::out_of_range("Index out of range")
                         : data_[pos]);
 }
 
-template <typename T, typename Alloc>
-inline typename vector<T, Alloc>::const_reference vector<T, Alloc>::at(
-    size_type pos) const {
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::const_reference
+vector<T, Alloc, Growth>::at(size_type pos) const {
   return (pos >= size() ? throw std::out_of_range("Index out of range")
                         : data_[pos]);
 }
 
-template <typename T, typename Alloc>
-typename vector<T, Alloc>::reference vector<T, Alloc>::operator[](
-    size_type pos) {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::reference
+vector<T, Alloc, Growth>::operator[](size_type pos) {
   return data_[pos];
 }
 
-template <typename T, typename Alloc>
-typename vector<T, Alloc>::const_reference vector<T, Alloc>::operator[](
-    size_type pos) const {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::const_reference
+vector<T, Alloc, Growth>::operator[](size_type pos) const {
   return data_[pos];
 }
 
-template <typename T, typename Alloc>
-typename vector<T, Alloc>::reference vector<T, Alloc>::front() {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::reference vector<T, Alloc, Growth>::front() {
   return data_[0];
 }
 
-template <typename T, typename Alloc>
-typename vector<T, Alloc>::const_reference vector<T, Alloc>::front() const {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::const_reference
+vector<T, Alloc, Growth>::front() const {
   return data_[0];
 }
 
-template <typename T, typename Alloc>
-typename vector<T, Alloc>::reference vector<T, Alloc>::back() {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::reference vector<T, Alloc, Growth>::back() {
   return (size_ > 0 ? data_[size_ - 1]
                     : throw std::out_of_range("Index out of range"));
 }
 
-template <typename T, typename Alloc>
-typename vector<T, Alloc>::const_reference vector<T, Alloc>::back() const {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::const_reference
+vector<T, Alloc, Growth>::back() const {
   return (size_ > 0 ? data_[size_ - 1]
                     : throw std::out_of_range("Index out of range"));
 }
 
-template <typename T, typename Alloc>
-inline typename vector<T, Alloc>::iterator vector<T, Alloc>::data() noexcept {
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::iterator
+vector<T, Alloc, Growth>::data() noexcept {
   return data_;
 }
 
-template <typename T, typename Alloc>
-typename vector<T, Alloc>::iterator vector<T, Alloc>::begin() noexcept {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::iterator
+vector<T, Alloc, Growth>::begin() noexcept {
   return data_;
 }
 
-template <typename T, typename Alloc>
-typename vector<T, Alloc>::const_iterator vector<T, Alloc>::begin()
-    const noexcept {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::const_iterator
+vector<T, Alloc, Growth>::begin() const noexcept {
   return data_;
 }
 
-template <typename T, typename Alloc>
-typename vector<T, Alloc>::iterator vector<T, Alloc>::end() noexcept {
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::iterator
+vector<T, Alloc, Growth>::end() noexcept {
   return (data_ + size());
 }
 
-template <typename T, typename Alloc>
-inline typename vector<T, Alloc>::const_iterator vector<T, Alloc>::end()
-    const noexcept {
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::const_iterator
+vector<T, Alloc, Growth>::end() const noexcept {
   return (data_ + size());
 }
 
-template <typename T, typename Alloc>
-inline void vector<T, Alloc>::clear() {
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::clear() {
   if (data_) {
     for (size_type i = 0; i < size_; ++i) {
       alloc_traits::destroy(alloc_, data_ + i);
@@ -280,315 +475,657 @@ inline void vector<T, Alloc>::clear() {
   size_ = 0;
 }
 
-template <typename T, typename Alloc>
-inline typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(
-    iterator pos) {
+// Growing value-initialises the new elements, which for numbers means
+// zeroes; resize_for_overwrite() leaves trivially constructible ones
+// uninitialised. All three grow the buffer like push_back, and shrinking
+// keeps the capacity.
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::resize(size_type count) {
+  if (count < size_) {
+    erase(begin() + count, end());
+  } else {
+    append_initialized<true>(count - size_);
+  }
+}
+
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::resize(size_type count,
+                                             const_reference value) {
+  if (count < size_) {
+    erase(begin() + count, end());
+  } else {
+    insert(end(), count - size_, value);
+  }
+}
+
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::resize_for_overwrite(size_type count) {
+  if (count < size_) {
+    erase(begin() + count, end());
+  } else {
+    append_initialized<false>(count - size_);
+  }
+}
+
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::iterator
+vector<T, Alloc, Growth>::erase(iterator pos) {
   if (pos < begin() || pos >= end()) {
     throw std::out_of_range("Iterator out of range");
   }
-  size_t iter_pos = pos - begin();
+  return erase(pos, pos + 1);
+}
 
-  --size_;
-  for (size_type i = iter_pos; i < size_; ++i) {
-    data_[i] = std::move(data_[i + 1]);
+template <typename T, typename Alloc, typename Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::erase(
+    const_iterator first, const_iterator last) {
+  if (first < begin() || last > end() || first > last) {
+    throw std::out_of_range("Iterator out of range");
   }
+  size_type iter_pos = first - begin();
+  size_type count = last - first;
+  if (count == 0) return begin() + iter_pos;
+
+  size_type tail = size_ - iter_pos - count;
+  if constexpr (kTrivial) {
+    if (tail > 0)
+      std::memmove(data_ + iter_pos, data_ + iter_pos + count,
+                   tail * sizeof(value_type));
+  } else {
+    std::move(begin() + iter_pos + count, end(), begin() + iter_pos);
+    for (size_type i = size_ - count; i < size_; ++i) {
+      alloc_traits::destroy(alloc_, data_ + i);
+    }
+  }
+  size_ -= count;
 
   return begin() + iter_pos;
 }
 
-template <typename T, typename Alloc>
-inline void vector<T, Alloc>::push_back(const_reference value) {
-  if (size_ == capacity_) {
-    size_type new_capacity = (capacity_ > 0 ? capacity_ * 2 : 1);
-    iterator new_data = alloc_traits::allocate(alloc_, new_capacity);
+// Removes pos in O(1) by moving the last element into its place, so the
+// order of the elements is not kept.
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::iterator
+vector<T, Alloc, Growth>::swap_and_pop(iterator pos) {
+  if (pos < begin() || pos >= end()) {
+    throw std::out_of_range("Iterator out of range");
+  }
+  if (pos != end() - 1) *pos = std::move(back());
+  pop_back();
+  return pos;
+}
 
-    copy_from_data(new_data);
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::push_back(const_reference value) {
+  emplace_back(value);
+}
 
-    add_value_in_back(new_data, value);
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::push_back(T &&value) {
+  emplace_back(std::move(value));
+}
 
+// When the buffer is full the new element is constructed in the new buffer
+// before the old elements are moved over, so args may refer to an element
+// of this vector.
+template <typename T, typename Alloc, typename Growth>
+template <typename... Args>
+inline typename vector<T, Alloc, Growth>::reference
+vector<T, Alloc, Growth>::emplace_back(Args &&...args) {
+  if (size_ < capacity_) {
+    alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+  } else if constexpr (kTrivial) {
+    value_type value(std::forward<Args>(args)...);
+    reallocate_data(grow_capacity(1));
+    alloc_traits::construct(alloc_, data_ + size_, std::move(value));
+  } else {
+    size_type new_capacity = grow_capacity(1);
+    iterator new_data = allocate_data(new_capacity);
+    try {
+      alloc_traits::construct(alloc_, new_data + size_,
+                              std::forward<Args>(args)...);
+    } catch (...) {
+      deallocate_data(new_data, new_capacity);
+      throw;
+    }
+    try {
+      copy_from_data(new_data);
+    } catch (...) {
+      alloc_traits::destroy(alloc_, new_data + size_);
+      deallocate_data(new_data, new_capacity);
+      throw;
+    }
     destroy_data();
-
-    capacity_ = new_capacity;
     data_ = new_data;
-  } else {
-    add_value_in_back(data_, value);
+    capacity_ = new_capacity;
+  }
+  return data_[size_++];
+}
+
+// The element is built up front because args may refer to an element that
+// the shift below moves.
+template <typename T, typename Alloc, typename Growth>
+template <typename... Args>
+inline typename vector<T, Alloc, Growth>::iterator
+vector<T, Alloc, Growth>::emplace(const_iterator pos, Args &&...args) {
+  if (pos < begin() || pos > end()) {
+    throw std::out_of_range("Iterator out of range");
+  }
+  size_type iter_pos = pos - begin();
+  if (iter_pos == size_) {
+    emplace_back(std::forward<Args>(args)...);
+    return begin() + iter_pos;
+  }
+
+  value_type value(std::forward<Args>(args)...);
+  open_gap(iter_pos, 1);
+  try {
+    alloc_traits::construct(alloc_, data_ + iter_pos, std::move(value));
+  } catch (...) {
+    close_gap(iter_pos, 1, 0);
+    throw;
   }
   ++size_;
+
+  return begin() + iter_pos;
 }
 
-template <typename T, typename Alloc>
-inline void vector<T, Alloc>::pop_back() {
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::pop_back() {
   if (!empty()) {
     --size_;
-    (data_ + size_)->~value_type();
+    alloc_traits::destroy(alloc_, data_ + size_);
   }
 }
 
-template <typename T, typename Alloc>
-inline void vector<T, Alloc>::swap(vector &other) noexcept(
-    alloc_traits::propagate_on_container_swap::value) {
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::swap(vector &other) noexcept(
+    alloc_traits::propagate_on_container_swap::value ||
+    alloc_traits::is_always_equal::value) {
   if (this != &other) {
     std::swap(size_, other.size_);
     std::swap(capacity_, other.capacity_);
-    std::swap(alloc_, other.alloc_);
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
     std::swap(data_, other.data_);
   }
 }
 
-template <typename T, typename Alloc>
-inline bool vector<T, Alloc>::empty() const noexcept {
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::allocator_type
+vector<T, Alloc, Growth>::get_allocator() const {
+  return alloc_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+inline bool vector<T, Alloc, Growth>::empty() const noexcept {
   return size() == 0;
 }
 
-template <typename T, typename Alloc>
-inline typename vector<T, Alloc>::size_type vector<T, Alloc>::max_size() const {
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::size_type
+vector<T, Alloc, Growth>::max_size() const {
   size_type max_alloc = alloc_traits::max_size(alloc_);
   return max_alloc;
 }
 
-template <typename T, typename Alloc>
-inline typename vector<T, Alloc>::size_type vector<T, Alloc>::size() const {
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::size_type
+vector<T, Alloc, Growth>::size() const {
   return size_;
 }
 
-template <typename T, typename Alloc>
-void vector<T, Alloc>::reserve(size_type new_capacity) {
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::reserve(size_type new_capacity) {
   if (new_capacity <= capacity_) {
     return;
   }
 
-  iterator new_data = alloc_traits::allocate(alloc_, new_capacity);
-
-  copy_from_data(new_data);
-
-  destroy_data();
-
-  data_ = new_data;
-  capacity_ = new_capacity;
+  reallocate_data(new_capacity);
 }
 
-template <typename T, typename Alloc>
-inline typename vector<T, Alloc>::size_type vector<T, Alloc>::capacity() const {
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::size_type
+vector<T, Alloc, Growth>::capacity() const {
   return capacity_;
 }
 
-template <typename T, typename Alloc>
-inline void vector<T, Alloc>::shrink_to_fit() {
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::shrink_to_fit() {
   if (size_ < capacity_) {
-    iterator new_data = alloc_traits::allocate(alloc_, size_);
+    reallocate_data(size_);
+  }
+}
 
-    copy_from_data(new_data);
-    destroy_data();
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::iterator
+vector<T, Alloc, Growth>::insert(const_iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
 
-    data_ = new_data;
-    capacity_ = size_;
-  }
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::iterator
+vector<T, Alloc, Growth>::insert(const_iterator pos, T &&value) {
+  return emplace(pos, std::move(value));
 }
 
-template <typename T, typename Alloc>
-inline typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(
-    const_iterator pos, const_reference value) {
+// The value is copied first because it may refer to an element that the
+// gap moves or that growing the buffer frees.
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::iterator
+vector<T, Alloc, Growth>::insert(const_iterator pos, size_type count,
+                                 const T &value) {
   if (pos < begin() || pos > end()) {
     throw std::out_of_range("Iterator out of range");
   }
+  size_type iter_pos = pos - begin();
+  if (count == 0) return begin() + iter_pos;
 
-  size_t iter_pos = pos - begin();
-  if (size_ == capacity_) {
-    reserve((capacity_ > 0 ? capacity_ * 2 : 1));
-  }
-
+  value_type copy(value);
+  open_gap(iter_pos, count);
+  size_type built = 0;
   try {
-    alloc_traits::construct(alloc_, data_ + size_, value_type(value_type()));
-  } catch (...) {
-    for (size_type j = 0; j < size_; ++j) {
-      alloc_traits::destroy(alloc_, data_ + j);
+    for (; built < count; ++built) {
+      alloc_traits::construct(alloc_, data_ + iter_pos + built, copy);
     }
-    alloc_traits::deallocate(alloc_, data_, size_);
+  } catch (...) {
+    close_gap(iter_pos, count, built);
     throw;
   }
-
-  for (size_type i = size_; i > iter_pos; --i) {
-    data_[i] = std::move(data_[i - 1]);
-  }
-
-  data_[iter_pos] = value;
-  ++size_;
+  size_ += count;
 
   return begin() + iter_pos;
 }
 
-template <typename T, typename Alloc>
-inline typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(
-    const_iterator pos, T &&value) {
+// Single-pass input is appended and then rotated into place, since its
+// length is not known up front.
+template <typename T, typename Alloc, typename Growth>
+template <typename InputIt, typename>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::insert(
+    const_iterator pos, InputIt first, InputIt last) {
   if (pos < begin() || pos > end()) {
     throw std::out_of_range("Iterator out of range");
   }
-  size_t iter_pos = pos - begin();
-  if (size_ == capacity_) {
-    reserve((capacity_ > 0 ? capacity_ * 2 : 1));
-  }
-
-  try {
-    alloc_traits::construct(alloc_, data_ + size_, value_type(value_type()));
-  } catch (...) {
-    for (size_type j = 0; j < size_; ++j) {
-      alloc_traits::destroy(alloc_, data_ + j);
-    }
-    alloc_traits::deallocate(alloc_, data_, size_);
-    throw;
-  }
-
-  for (size_type i = size_; i > iter_pos; --i) {
-    data_[i] = std::move(data_[i - 1]);
+  size_type iter_pos = pos - begin();
+  if constexpr (std::is_convertible_v<
+                    typename std::iterator_traits<InputIt>::iterator_category,
+                    std::forward_iterator_tag>) {
+    size_type count = std::distance(first, last);
+    open_gap(iter_pos, count);
+    construct_in_gap(iter_pos, first, count);
+  } else {
+    size_type old_size = size_;
+    for (; first != last; ++first) emplace_back(*first);
+    std::rotate(begin() + iter_pos, begin() + old_size, end());
   }
-
-  data_[iter_pos] = std::move(value);
-  ++size_;
-
   return begin() + iter_pos;
 }
 
-template <typename T, typename Alloc>
-inline typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(
-    const_iterator pos, size_type count, const T &value) {
+template <typename T, typename Alloc, typename Growth>
+template <typename Range>
+inline void vector<T, Alloc, Growth>::append_range(Range &&range) {
+  insert(end(), std::begin(range), std::end(range));
+}
+
+// The elements are built up front, as in emplace(), because args may refer
+// to elements that open_gap() shifts or frees.
+template <typename T, typename Alloc, typename Growth>
+template <typename... Args>
+inline typename vector<T, Alloc, Growth>::iterator
+vector<T, Alloc, Growth>::insert_many(const_iterator pos, Args &&...args) {
   if (pos < begin() || pos > end()) {
     throw std::out_of_range("Iterator out of range");
   }
-  size_t iter_pos = pos - begin();
-  if (size_ + count >= capacity_) {
-    reserve(size_ + count);
-  }
+  size_type iter_pos = pos - begin();
+  constexpr size_type count = sizeof...(Args);
 
-  init_value_type_for_insert(size_ + count);
-
-  for (size_type i = size_ + count - 1; i >= iter_pos + count; --i) {
-    data_[i] = std::move(data_[i - count]);
-  }
-
-  for (size_type i = iter_pos; i < iter_pos + count; ++i) {
-    data_[i] = value;
+  if constexpr (count > 0) {
+    value_type values[] = {value_type(std::forward<Args>(args))...};
+    open_gap(iter_pos, count);
+    construct_in_gap(iter_pos, std::make_move_iterator(values), count);
   }
 
-  size_ += count;
-
   return begin() + iter_pos;
 }
 
-template <typename T, typename Alloc>
+template <typename T, typename Alloc, typename Growth>
 template <typename... Args>
-inline typename vector<T, Alloc>::iterator vector<T, Alloc>::insert_many(
-    const_iterator pos, Args &&...args) {
-  if (pos < begin() || pos > end()) {
-    throw std::out_of_range("Iterator out of range");
-  }
-
-  size_t iter_pos = pos - begin();
-  size_type count = (sizeof...(Args));
-  if (size_ + count >= capacity_) {
-    reserve(size_ + count);
-  }
+inline void vector<T, Alloc, Growth>::insert_many_back(Args &&...args) {
+  insert_many(end(), std::forward<Args>(args)...);
+}
 
-  init_value_type_for_insert(size_ + count);
+// ADDITIONAL FUNCTIONS
 
-  for (size_type i = size_ + count - 1; i >= iter_pos + count; --i) {
-    data_[i] = std::move(data_[i - count]);
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::iterator
+vector<T, Alloc, Growth>::allocate_data(size_type n) {
+  if constexpr (kUseMalloc) {
+    if (n == 0) return nullptr;
+    if (n > max_size()) throw std::bad_alloc();
+    void *data = std::malloc(n * sizeof(value_type));
+    if (data == nullptr) throw std::bad_alloc();
+    return static_cast<iterator>(data);
+  } else {
+    return alloc_traits::allocate(alloc_, n);
   }
+}
 
-  size_type i = iter_pos;
-  ((data_[i++] = std::move(args)), ...);
-  size_ += sizeof...(Args);
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::deallocate_data(iterator data,
+                                                      size_type n) {
+  if constexpr (kUseMalloc) {
+    std::free(data);
+  } else if (data != nullptr) {
+    alloc_traits::deallocate(alloc_, data, n);
+  }
+}
 
-  return begin() + iter_pos;
+// Trivially copyable elements are moved by realloc itself, which glibc
+// serves with mremap for large blocks, so growing a big buffer does not
+// copy it at all.
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::reallocate_data(size_type new_capacity) {
+  if constexpr (kUseMalloc) {
+    if (new_capacity == 0) {
+      std::free(data_);
+      data_ = nullptr;
+    } else {
+      if (new_capacity > max_size()) throw std::bad_alloc();
+      void *new_data = std::realloc(data_, new_capacity * sizeof(value_type));
+      if (new_data == nullptr) throw std::bad_alloc();
+      data_ = static_cast<iterator>(new_data);
+      new_capacity = block_capacity(data_, new_capacity);
+    }
+  } else {
+    iterator new_data = allocate_data(new_capacity);
+    try {
+      copy_from_data(new_data);
+    } catch (...) {
+      deallocate_data(new_data, new_capacity);
+      throw;
+    }
+    destroy_data();
+    data_ = new_data;
+  }
+  capacity_ = new_capacity;
 }
 
-template <typename T, typename Alloc>
-template <typename... Args>
-inline void vector<T, Alloc>::insert_many_back(Args &&...args) {
-  size_type count = (sizeof...(Args));
-  if (size_ + count >= capacity_) {
-    reserve(size_ + count);
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::destroy_data() {
+  if constexpr (!kTrivial) {
+    for (size_type i = 0; i < size_; ++i) {
+      alloc_traits::destroy(alloc_, data_ + i);
+    }
   }
 
-  init_value_type_for_insert(size_ + count);
+  deallocate_data(data_, capacity_);
+}
 
-  size_type i = size_;
-  ((data_[i++] = std::move(args)), ...);
-  size_ += sizeof...(Args);
+// Asks the growth policy for room for count more elements.
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::size_type
+vector<T, Alloc, Growth>::grow_capacity(size_type count) const {
+  if (max_size() - size_ < count) {
+    throw std::length_error("Vector is too long");
+  }
+  size_type required = size_ + count;
+  size_type new_capacity = Growth::next(size_, required);
+  if (new_capacity < required) new_capacity = required;
+  return (new_capacity > max_size() ? max_size() : new_capacity);
 }
 
-// ADDITIONAL FUNCTIONS
+// The number of elements that really fit into a malloc block of n elements.
+template <typename T, typename Alloc, typename Growth>
+inline typename vector<T, Alloc, Growth>::size_type
+vector<T, Alloc, Growth>::block_capacity([[maybe_unused]] iterator data,
+                                         size_type n) const {
+  if constexpr (kRoundToBlock) {
+    if (data == nullptr) return n;
+#if defined(__GLIBC__)
+    size_type usable = malloc_usable_size(data) / sizeof(value_type);
+#else
+    size_type usable = malloc_size(data) / sizeof(value_type);
+#endif
+    return (usable > n ? usable : n);
+  } else {
+    return n;
+  }
+}
 
-template <typename T, typename Alloc>
-inline void vector<T, Alloc>::destroy_data() {
-  for (size_type i = 0; i < size_; ++i) {
-    alloc_traits::destroy(alloc_, data_ + i);
+// Leaves count uninitialized slots at iter_pos, so the caller can construct
+// the new elements in place. size_ is not changed. When the buffer has to
+// grow, every old element is moved straight to its final slot.
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::open_gap(size_type iter_pos, size_type count) {
+  if (count == 0) return;
+  size_type tail = size_ - iter_pos;
+  if (size_ + count > capacity_) {
+    size_type new_capacity = grow_capacity(count);
+    if constexpr (kUseMalloc) {
+      reallocate_data(new_capacity);
+    } else {
+      iterator new_data = allocate_data(new_capacity);
+      if constexpr (kTrivial) {
+        if (iter_pos > 0)
+          std::memcpy(new_data, data_, iter_pos * sizeof(value_type));
+        if (tail > 0)
+          std::memcpy(new_data + iter_pos + count, data_ + iter_pos,
+                      tail * sizeof(value_type));
+      } else {
+        size_type moved = 0;
+        try {
+          for (; moved < size_; ++moved) {
+            size_type to = (moved < iter_pos ? moved : moved + count);
+            alloc_traits::construct(alloc_, new_data + to,
+                                    std::move_if_noexcept(data_[moved]));
+          }
+        } catch (...) {
+          for (size_type j = 0; j < moved; ++j) {
+            alloc_traits::destroy(alloc_,
+                                  new_data + (j < iter_pos ? j : j + count));
+          }
+          deallocate_data(new_data, new_capacity);
+          throw;
+        }
+      }
+      destroy_data();
+      data_ = new_data;
+      capacity_ = new_capacity;
+      return;
+    }
   }
 
-  alloc_traits::deallocate(alloc_, data_, capacity_);
+  if constexpr (kTrivial) {
+    if (tail > 0)
+      std::memmove(data_ + iter_pos + count, data_ + iter_pos,
+                   tail * sizeof(value_type));
+  } else {
+    for (size_type i = size_; i > iter_pos; --i) {
+      size_type to = i - 1 + count;
+      if (to >= size_) {
+        alloc_traits::construct(alloc_, data_ + to, std::move(data_[i - 1]));
+      } else {
+        data_[to] = std::move(data_[i - 1]);
+      }
+    }
+    for (size_type i = iter_pos; i < iter_pos + count && i < size_; ++i) {
+      alloc_traits::destroy(alloc_, data_ + i);
+    }
+  }
 }
 
-template <typename T, typename Alloc>
-inline void vector<T, Alloc>::init_value_type_for_insert(size_type length) {
-  for (size_type i = size_; i < length; ++i) {
+// Appends count new elements, value-initialised or, with ValueInit false,
+// default-initialised: trivially constructible ones are not touched at all.
+// Numbers from malloc are value-initialised by a single memset.
+template <typename T, typename Alloc, typename Growth>
+template <bool ValueInit>
+void vector<T, Alloc, Growth>::append_initialized(size_type count) {
+  if (count == 0) return;
+  open_gap(size_, count);
+  constexpr bool kSkip =
+      !ValueInit && std::is_trivially_default_constructible_v<T>;
+  if constexpr (!kSkip && kUseMalloc && std::is_arithmetic_v<T>) {
+    std::memset(static_cast<void *>(data_ + size_), 0,
+                count * sizeof(value_type));
+  } else if constexpr (!kSkip) {
+    size_type built = 0;
     try {
-      alloc_traits::construct(alloc_, data_ + i, value_type(value_type()));
+      for (; built < count; ++built) {
+        alloc_traits::construct(alloc_, data_ + size_ + built);
+      }
     } catch (...) {
-      for (size_type j = 0; j < i; ++j) {
-        alloc_traits::destroy(alloc_, data_ + j);
+      close_gap(size_, count, built);
+      throw;
+    }
+  }
+  size_ += count;
+}
+
+// Copies count elements starting at first into the gap left by open_gap and
+// counts them in size_. A contiguous source of trivially copyable elements
+// is copied with a single memcpy.
+template <typename T, typename Alloc, typename Growth>
+template <typename ForwardIt>
+void vector<T, Alloc, Growth>::construct_in_gap(
+    size_type iter_pos, ForwardIt first, size_type count) {
+  if constexpr (kTrivial && std::is_pointer_v<ForwardIt> &&
+                std::is_same_v<std::remove_cv_t<std::remove_pointer_t<
+                                   ForwardIt>>,
+                               value_type>) {
+    if (count > 0)
+      std::memcpy(data_ + iter_pos, first, count * sizeof(value_type));
+  } else {
+    size_type built = 0;
+    try {
+      for (; built < count; ++built, ++first) {
+        alloc_traits::construct(alloc_, data_ + iter_pos + built, *first);
       }
-      alloc_traits::deallocate(alloc_, data_, size_);
+    } catch (...) {
+      close_gap(iter_pos, count, built);
       throw;
     }
   }
+  size_ += count;
 }
 
-template <typename T, typename Alloc>
-inline void vector<T, Alloc>::add_value_in_back(iterator cur_data,
-                                                const_reference value) {
-  try {
-    alloc_traits::construct(alloc_, cur_data + size_, value_type(value));
-  } catch (...) {
-    for (size_type j = 0; j < size_; ++j) {
-      alloc_traits::destroy(alloc_, cur_data + j);
+// Undoes open_gap after constructing the element number built of the gap
+// threw: drops the elements built so far and moves the tail back.
+template <typename T, typename Alloc, typename Growth>
+void vector<T, Alloc, Growth>::close_gap(size_type iter_pos, size_type count,
+                                         size_type built) {
+  size_type tail = size_ - iter_pos;
+  if constexpr (kTrivial) {
+    if (tail > 0)
+      std::memmove(data_ + iter_pos, data_ + iter_pos + count,
+                   tail * sizeof(value_type));
+  } else {
+    for (size_type i = 0; i < built; ++i) {
+      alloc_traits::destroy(alloc_, data_ + iter_pos + i);
+    }
+    for (size_type from = iter_pos + count; from < size_ + count; ++from) {
+      size_type to = from - count;
+      if (to < iter_pos + count) {
+        alloc_traits::construct(alloc_, data_ + to, std::move(data_[from]));
+      } else {
+        data_[to] = std::move(data_[from]);
+      }
+    }
+    size_type gap_end = iter_pos + count;
+    for (size_type i = (size_ > gap_end ? size_ : gap_end); i < size_ + count;
+         ++i) {
+      alloc_traits::destroy(alloc_, data_ + i);
     }
-    alloc_traits::deallocate(alloc_, cur_data, size_);
-    throw;
   }
 }
 
-template <typename T, typename Alloc>
-inline void vector<T, Alloc>::copy_in_data(const iterator other_data) {
-  data_ = alloc_traits::allocate(alloc_, capacity_);
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::copy_in_data(const iterator other_data) {
+  data_ = allocate_data(capacity_);
+  if constexpr (kTrivial) {
+    if (size_ > 0)
+      std::memcpy(data_, other_data, size_ * sizeof(value_type));
+    return;
+  }
 
   for (size_type i = 0; i < size_; ++i) {
     try {
-      alloc_traits::construct(alloc_, data_ + i, value_type(other_data[i]));
+      alloc_traits::construct(alloc_, data_ + i, other_data[i]);
     } catch (...) {
       for (size_type j = 0; j < i; ++j) {
         alloc_traits::destroy(alloc_, data_ + j);
       }
-      alloc_traits::deallocate(alloc_, data_, size_);
+      deallocate_data(data_, capacity_);
       throw;
     }
   }
 }
 
-template <typename T, typename Alloc>
-inline void vector<T, Alloc>::copy_from_data(iterator new_data) {
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::copy_from_data(iterator new_data) {
+  if constexpr (kTrivial) {
+    if (size_ > 0) std::memcpy(new_data, data_, size_ * sizeof(value_type));
+    return;
+  }
   for (size_type i = 0; i < size_; ++i) {
     try {
       alloc_traits::construct(alloc_, new_data + i,
-                              std::move(value_type(data_[i])));
+                              std::move_if_noexcept(data_[i]));
     } catch (...) {
       for (size_type j = 0; j < i; ++j) {
         alloc_traits::destroy(alloc_, new_data + j);
       }
-      alloc_traits::deallocate(alloc_, new_data, size_);
       throw;
     }
   }
 }
 
+// Takes the buffer of other, whose memory this allocator can free. The
+// current buffer must already be released.
+template <typename T, typename Alloc, typename Growth>
+inline void vector<T, Alloc, Growth>::steal_data(vector &other) noexcept {
+  data_ = other.data_;
+  size_ = other.size_;
+  capacity_ = other.capacity_;
+  other.data_ = nullptr;
+  other.size_ = 0;
+  other.capacity_ = 0;
+}
+
+// Removes every element matching pred in one pass and returns how many were
+// removed. Trivially copyable elements are compacted by moving whole runs of
+// kept elements with memmove.
+template <typename T, typename Alloc, typename Growth, typename Pred>
+typename vector<T, Alloc, Growth>::size_type erase_if(
+    vector<T, Alloc, Growth> &v, Pred pred) {
+  auto first = v.begin();
+  auto last = v.end();
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    auto out = first;
+    auto run = first;
+    for (auto it = first; it != last; ++it) {
+      if (pred(*it)) {
+        if (out != run) std::memmove(out, run, (it - run) * sizeof(T));
+        out += it - run;
+        run = it + 1;
+      }
+    }
+    if (out != run) std::memmove(out, run, (last - run) * sizeof(T));
+    first = out + (last - run);
+  } else {
+    first = std::remove_if(first, last, pred);
+  }
+  typename vector<T, Alloc, Growth>::size_type removed = last - first;
+  v.erase(first, last);
+  return removed;
+}
+
+template <typename T, typename Alloc, typename Growth, typename U>
+inline typename vector<T, Alloc, Growth>::size_type erase(
+    vector<T, Alloc, Growth> &v, const U &value) {
+  return erase_if(v, [&value](const T &element) { return element == value; });
+}
+
 }  // namespace s21
 
-#endif  // S21_CONTAINERS_S21_VECTOR_H
\ No newline at end of file
+#endif  // S21_CONTAINERS_S21_VECTOR_H
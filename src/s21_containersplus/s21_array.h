@@ -1,9 +1,68 @@
 #ifndef S21_CONTAINERSPLUS_S21_ARRAY_H
 #define S21_CONTAINERSPLUS_S21_ARRAY_H
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_simd.h"
+
 namespace s21 {
-template <typename T, size_t N>
+namespace detail {
+// True while the compiler evaluates a constant expression, where the
+// s21::simd kernels and the std algorithms of C++17 cannot run. Compilers
+// without the builtin always take the constexpr path.
+constexpr bool in_constant_evaluation() noexcept {
+#if defined(__GNUC__)
+  return __builtin_is_constant_evaluated();
+#else
+  return true;
+#endif
+}
+
+template <typename T>
+constexpr void constexpr_swap(T &a, T &b) {
+  T moved = std::move(a);
+  a = std::move(b);
+  b = std::move(moved);
+}
+
+template <typename T, typename Compare>
+constexpr void sift_down(T *data, size_t root, size_t size, Compare &comp) {
+  for (size_t child = 2 * root + 1; child < size; child = 2 * root + 1) {
+    if (child + 1 < size && comp(data[child], data[child + 1])) ++child;
+    if (!comp(data[root], data[child])) return;
+    constexpr_swap(data[root], data[child]);
+    root = child;
+  }
+}
+
+// A heap sort: O(n log n) without recursion, which keeps it within the
+// limits compilers put on constant evaluation.
+template <typename T, typename Compare>
+constexpr void heap_sort(T *data, size_t size, Compare &comp) {
+  for (size_t i = size / 2; i-- > 0;) sift_down(data, i, size, comp);
+  for (size_t end = size; end-- > 1;) {
+    constexpr_swap(data[0], data[end]);
+    sift_down(data, 0, end, comp);
+  }
+}
+}  // namespace detail
+
+// A fixed-size array whose storage starts on an Align-byte boundary, so
+// that vector kernels may rely on 32- or 64-byte alignment. Every member is
+// constexpr: arrays of literal types can be built, filled, sorted and
+// searched at compile time and stored in the binary as tables. fill(),
+// s21::sort() and s21::find() run the s21::simd kernels and std::sort when
+// they are not evaluated at compile time.
+template <typename T, size_t N, size_t Align = alignof(T)>
 class array {
+  static_assert(Align >= alignof(T) && (Align & (Align - 1)) == 0,
+                "Align must be a power of two no smaller than alignof(T)");
+
  public:
   using value_type = T;
   using reference = T &;
@@ -12,45 +71,35 @@ class array {
   using const_iterator = const T *;
   using size_type = size_t;
 
+  static constexpr size_type alignment = Align;
+
   array() = default;
 
-  array(std::initializer_list<value_type> const &items) {
+  constexpr array(std::initializer_list<value_type> const &items)
+      : values_() {
+    if (items.size() > N) throw std::length_error("Too many initializers");
     size_type i = 0;
-
     for (auto it = items.begin(); it != items.end(); ++it) {
       values_[i++] = *it;
     }
-
-    for (; i < N; ++i) {
-      values_[i] = value_type();
-    }
-  }
-
-  array(const array &a) {
-    for (size_type i = 0; i < a.size_; ++i) {
-      values_[i] = a.values_[i];
-    }
-  }
-
-  array(array &&a) noexcept {
-    for (size_type i = 0; i < N; ++i) {
-      values_[i] = std::move(a.values_[i]);
-    }
   }
 
+  array(const array &a) = default;
+  array(array &&a) = default;
   ~array() = default;
 
-  array &operator=(array &&a) noexcept {
-    if (this != &a) {
-      for (size_type i = 0; i < a.size(); ++i) {
-        values_[i] = std::move(a.values_[i]);
-      }
+  array &operator=(const array &a) = default;
+  array &operator=(array &&a) = default;
+
+  constexpr reference at(size_type pos) {
+    if (pos >= N) {
+      throw std::out_of_range("Index out of range");
     }
 
-    return *this;
+    return values_[pos];
   }
 
-  reference at(size_type pos) {
+  constexpr const_reference at(size_type pos) const {
     if (pos >= N) {
       throw std::out_of_range("Index out of range");
     }
@@ -58,39 +107,82 @@ class array {
     return values_[pos];
   }
 
-  reference operator[](size_type pos) { return values_[pos]; }
+  constexpr reference operator[](size_type pos) { return values_[pos]; }
+  constexpr const_reference operator[](size_type pos) const {
+    return values_[pos];
+  }
 
-  const_reference front() { return values_[0]; }
+  constexpr reference front() { return values_[0]; }
+  constexpr const_reference front() const { return values_[0]; }
 
-  const_reference back() { return values_[N - 1]; }
+  constexpr reference back() { return values_[N - 1]; }
+  constexpr const_reference back() const { return values_[N - 1]; }
 
-  iterator data() { return begin(); }
+  constexpr iterator data() noexcept { return values_; }
+  constexpr const_iterator data() const noexcept { return values_; }
 
-  iterator begin() { return values_; }
+  constexpr iterator begin() noexcept { return values_; }
+  constexpr const_iterator begin() const noexcept { return values_; }
+  constexpr const_iterator cbegin() const noexcept { return values_; }
 
-  iterator end() { return values_ + N; }
+  constexpr iterator end() noexcept { return values_ + N; }
+  constexpr const_iterator end() const noexcept { return values_ + N; }
+  constexpr const_iterator cend() const noexcept { return values_ + N; }
 
-  bool empty() { return N == 0; }
+  constexpr bool empty() const noexcept { return N == 0; }
 
-  size_type size() { return N; }
+  constexpr size_type size() const noexcept { return N; }
 
-  size_type max_size() { return N; }
+  constexpr size_type max_size() const noexcept { return N; }
 
-  void swap(array &other) {
+  constexpr void swap(array &other) {
     for (size_type i = 0; i < N; ++i) {
-      std::swap(values_[i], other.values_[i]);
+      detail::constexpr_swap(values_[i], other.values_[i]);
     }
   }
 
-  void fill(const_reference value) {
-    for (size_type i = 0; i < N; ++i) {
-      values_[i] = value;
+  constexpr void fill(const_reference value) {
+    if (detail::in_constant_evaluation()) {
+      for (size_type i = 0; i < N; ++i) values_[i] = value;
+    } else {
+      simd::fill(values_, values_ + N, value);
     }
   }
 
  private:
-  value_type values_[N];
+  // One element even when N is zero, as a zero-length array is not C++.
+  alignas(Align) value_type values_[N > 0 ? N : 1];
 };
+
+template <typename T, size_t N, size_t Align, typename Compare = std::less<>>
+constexpr void sort(array<T, N, Align> &a, Compare comp = Compare()) {
+  if (detail::in_constant_evaluation()) {
+    detail::heap_sort(a.data(), N, comp);
+  } else {
+    std::sort(a.begin(), a.end(), comp);
+  }
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename array<T, N, Align>::const_iterator find(
+    const array<T, N, Align> &a,
+    const typename array<T, N, Align>::value_type &value) {
+  if (!detail::in_constant_evaluation()) {
+    return simd::find(a.begin(), a.end(), value);
+  }
+  for (size_t i = 0; i < N; ++i) {
+    if (a[i] == value) return a.begin() + i;
+  }
+  return a.end();
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename array<T, N, Align>::iterator find(
+    array<T, N, Align> &a,
+    const typename array<T, N, Align>::value_type &value) {
+  const array<T, N, Align> &constant = a;
+  return a.begin() + (s21::find(constant, value) - constant.begin());
+}
 }  // namespace s21
 
-#endif  // S21_CONTAINERSPLUS_S21_ARRAY_H
\ No newline at end of file
+#endif  // S21_CONTAINERSPLUS_S21_ARRAY_H
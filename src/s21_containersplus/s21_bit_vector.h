@@ -0,0 +1,447 @@
+#ifndef S21_CONTAINERSPLUS_S21_BIT_VECTOR_H
+#define S21_CONTAINERSPLUS_S21_BIT_VECTOR_H
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_containers/s21_vector.h"
+
+namespace s21 {
+namespace detail {
+inline unsigned popcount64(uint64_t word) noexcept {
+#if defined(__GNUC__)
+  return static_cast<unsigned>(__builtin_popcountll(word));
+#else
+  return static_cast<unsigned>(std::bitset<64>(word).count());
+#endif
+}
+
+// Index of the lowest set bit; word must not be zero.
+inline unsigned countr_zero64(uint64_t word) noexcept {
+#if defined(__GNUC__)
+  return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+  unsigned bit = 0;
+  while ((word & 1) == 0) {
+    word >>= 1;
+    ++bit;
+  }
+  return bit;
+#endif
+}
+}  // namespace detail
+
+// A sequence of bits packed 64 to a word. count() and the bulk &=, |= and
+// ^= work a word at a time. rank1() and select1() answer "how many ones
+// before pos" and "where is the k-th one"; after build_index() they take
+// O(1) and O(log n) time, using a small table of one counts. Without an
+// up-to-date index they scan the words, and any change to the bits makes
+// the index out of date.
+class bit_vector {
+ public:
+  class reference;
+
+  using value_type = bool;
+  using const_reference = bool;
+  using size_type = size_t;
+  using word_type = uint64_t;
+
+  static constexpr size_type kWordBits = 64;
+
+  bit_vector() noexcept = default;
+  explicit bit_vector(size_type n, bool value = false);
+  bit_vector(std::initializer_list<bool> const &items);
+
+  reference at(size_type pos);
+  bool at(size_type pos) const;
+
+  reference operator[](size_type pos);
+  bool operator[](size_type pos) const;
+
+  bool front() const;
+  bool back() const;
+
+  bool test(size_type pos) const;
+  void set(size_type pos, bool value = true);
+  void reset(size_type pos);
+  void flip(size_type pos);
+  void set() noexcept;
+  void reset() noexcept;
+  void flip() noexcept;
+
+  const word_type *words() const noexcept;
+  size_type word_count() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type capacity() const noexcept;
+  void reserve(size_type new_capacity);
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  void resize(size_type count, bool value = false);
+  void push_back(bool value);
+  void pop_back();
+  void swap(bit_vector &other) noexcept;
+
+  size_type count() const noexcept;
+  bool all() const noexcept;
+  bool any() const noexcept;
+  bool none() const noexcept;
+
+  bit_vector &operator&=(const bit_vector &other);
+  bit_vector &operator|=(const bit_vector &other);
+  bit_vector &operator^=(const bit_vector &other);
+  bit_vector operator~() const;
+
+  void build_index();
+  bool has_index() const noexcept;
+  size_type rank1(size_type pos) const;
+  size_type select1(size_type k) const;
+
+ private:
+  // A rank block covers 8 words, a cache line. The select table keeps the
+  // block holding every kSelectSample-th one.
+  static constexpr size_type kBlockWords = 8;
+  static constexpr size_type kBlockBits = kBlockWords * kWordBits;
+  static constexpr size_type kSelectSample = 4096;
+
+  s21::vector<word_type> words_;
+  size_type size_ = 0;
+  s21::vector<size_type> rank_blocks_;
+  s21::vector<size_type> select_samples_;
+  size_type ones_ = 0;
+  bool indexed_ = false;
+
+  word_type tail_mask() const noexcept;
+  void clear_tail() noexcept;
+  void check_size(const bit_vector &other) const;
+  static size_type select_in_word(word_type word, size_type k) noexcept;
+};
+
+// Stands for one bit of a bit_vector, as std::vector<bool>::reference does.
+class bit_vector::reference {
+ public:
+  reference(bit_vector *vector, size_type pos) noexcept
+      : vector_(vector), pos_(pos) {}
+  reference(const reference &) noexcept = default;
+
+  reference &operator=(bool value) {
+    vector_->set(pos_, value);
+    return *this;
+  }
+
+  reference &operator=(const reference &other) {
+    return *this = static_cast<bool>(other);
+  }
+
+  operator bool() const { return vector_->test(pos_); }
+  bool operator~() const { return !vector_->test(pos_); }
+  void flip() { vector_->flip(pos_); }
+
+ private:
+  bit_vector *vector_;
+  size_type pos_;
+};
+
+inline bit_vector::bit_vector(size_type n, bool value) { resize(n, value); }
+
+inline bit_vector::bit_vector(std::initializer_list<bool> const &items) {
+  reserve(items.size());
+  for (bool item : items) push_back(item);
+}
+
+inline bit_vector::reference bit_vector::at(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return reference(this, pos);
+}
+
+inline bool bit_vector::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return test(pos);
+}
+
+inline bit_vector::reference bit_vector::operator[](size_type pos) {
+  return reference(this, pos);
+}
+
+inline bool bit_vector::operator[](size_type pos) const { return test(pos); }
+
+inline bool bit_vector::front() const { return at(0); }
+
+inline bool bit_vector::back() const {
+  if (size_ == 0) throw std::out_of_range("Index out of range");
+  return test(size_ - 1);
+}
+
+inline bool bit_vector::test(size_type pos) const {
+  return (words_[pos / kWordBits] >> (pos % kWordBits)) & 1;
+}
+
+inline void bit_vector::set(size_type pos, bool value) {
+  word_type bit = word_type(1) << (pos % kWordBits);
+  if (value) {
+    words_[pos / kWordBits] |= bit;
+  } else {
+    words_[pos / kWordBits] &= ~bit;
+  }
+  indexed_ = false;
+}
+
+inline void bit_vector::reset(size_type pos) { set(pos, false); }
+
+inline void bit_vector::flip(size_type pos) {
+  words_[pos / kWordBits] ^= word_type(1) << (pos % kWordBits);
+  indexed_ = false;
+}
+
+inline void bit_vector::set() noexcept {
+  for (word_type &word : words_) word = ~word_type(0);
+  clear_tail();
+  indexed_ = false;
+}
+
+inline void bit_vector::reset() noexcept {
+  for (word_type &word : words_) word = 0;
+  indexed_ = false;
+}
+
+inline void bit_vector::flip() noexcept {
+  for (word_type &word : words_) word = ~word;
+  clear_tail();
+  indexed_ = false;
+}
+
+// The packed words; bits past size() are zero.
+inline const bit_vector::word_type *bit_vector::words() const noexcept {
+  return words_.begin();
+}
+
+inline bit_vector::size_type bit_vector::word_count() const noexcept {
+  return words_.size();
+}
+
+inline bool bit_vector::empty() const noexcept { return size_ == 0; }
+
+inline bit_vector::size_type bit_vector::size() const noexcept {
+  return size_;
+}
+
+inline bit_vector::size_type bit_vector::capacity() const noexcept {
+  return words_.capacity() * kWordBits;
+}
+
+inline void bit_vector::reserve(size_type new_capacity) {
+  words_.reserve((new_capacity + kWordBits - 1) / kWordBits);
+}
+
+inline void bit_vector::shrink_to_fit() { words_.shrink_to_fit(); }
+
+inline void bit_vector::clear() noexcept {
+  words_.clear();
+  size_ = 0;
+  indexed_ = false;
+}
+
+inline void bit_vector::resize(size_type count, bool value) {
+  size_type old_size = size_;
+  size_type word_count = (count + kWordBits - 1) / kWordBits;
+  while (words_.size() > word_count) words_.pop_back();
+  word_type fill = (value ? ~word_type(0) : 0);
+  if (count > old_size && value && old_size % kWordBits != 0) {
+    words_[old_size / kWordBits] |= ~word_type(0) << (old_size % kWordBits);
+  }
+  while (words_.size() < word_count) words_.push_back(fill);
+  size_ = count;
+  clear_tail();
+  indexed_ = false;
+}
+
+inline void bit_vector::push_back(bool value) {
+  if (size_ % kWordBits == 0) words_.push_back(0);
+  ++size_;
+  set(size_ - 1, value);
+}
+
+inline void bit_vector::pop_back() {
+  if (size_ > 0) resize(size_ - 1);
+}
+
+inline void bit_vector::swap(bit_vector &other) noexcept {
+  words_.swap(other.words_);
+  rank_blocks_.swap(other.rank_blocks_);
+  select_samples_.swap(other.select_samples_);
+  std::swap(size_, other.size_);
+  std::swap(ones_, other.ones_);
+  std::swap(indexed_, other.indexed_);
+}
+
+inline bit_vector::size_type bit_vector::count() const noexcept {
+  if (indexed_) return ones_;
+  size_type total = 0;
+  for (word_type word : words_) total += detail::popcount64(word);
+  return total;
+}
+
+inline bool bit_vector::all() const noexcept { return count() == size_; }
+
+inline bool bit_vector::any() const noexcept {
+  for (word_type word : words_) {
+    if (word != 0) return true;
+  }
+  return false;
+}
+
+inline bool bit_vector::none() const noexcept { return !any(); }
+
+inline bit_vector &bit_vector::operator&=(const bit_vector &other) {
+  check_size(other);
+  for (size_type i = 0; i < words_.size(); ++i) words_[i] &= other.words_[i];
+  indexed_ = false;
+  return *this;
+}
+
+inline bit_vector &bit_vector::operator|=(const bit_vector &other) {
+  check_size(other);
+  for (size_type i = 0; i < words_.size(); ++i) words_[i] |= other.words_[i];
+  indexed_ = false;
+  return *this;
+}
+
+inline bit_vector &bit_vector::operator^=(const bit_vector &other) {
+  check_size(other);
+  for (size_type i = 0; i < words_.size(); ++i) words_[i] ^= other.words_[i];
+  indexed_ = false;
+  return *this;
+}
+
+inline bit_vector bit_vector::operator~() const {
+  bit_vector result(*this);
+  result.flip();
+  return result;
+}
+
+// Counts the ones before every rank block and notes where every
+// kSelectSample-th one falls. The rank table takes 64 bits per 512, 1/8 of a
+// bit per bit, and the select samples at most 1/64 more.
+inline void bit_vector::build_index() {
+  rank_blocks_.clear();
+  select_samples_.clear();
+  size_type total = 0;
+  for (size_type i = 0; i < words_.size(); ++i) {
+    if (i % kBlockWords == 0) rank_blocks_.push_back(total);
+    size_type ones = detail::popcount64(words_[i]);
+    while (select_samples_.size() * kSelectSample < total + ones) {
+      select_samples_.push_back(i / kBlockWords);
+    }
+    total += ones;
+  }
+  rank_blocks_.push_back(total);
+  ones_ = total;
+  indexed_ = true;
+}
+
+inline bool bit_vector::has_index() const noexcept { return indexed_; }
+
+// The number of ones in [0, pos).
+inline bit_vector::size_type bit_vector::rank1(size_type pos) const {
+  if (pos > size_) throw std::out_of_range("Index out of range");
+  size_type word = pos / kWordBits;
+  size_type total = 0;
+  size_type i = 0;
+  if (indexed_) {
+    total = rank_blocks_[word / kBlockWords];
+    i = word / kBlockWords * kBlockWords;
+  }
+  for (; i < word; ++i) total += detail::popcount64(words_[i]);
+  if (pos % kWordBits != 0) {
+    word_type mask = ~word_type(0) >> (kWordBits - pos % kWordBits);
+    total += detail::popcount64(words_[word] & mask);
+  }
+  return total;
+}
+
+// The position of the one with rank k, counting from zero.
+inline bit_vector::size_type bit_vector::select1(size_type k) const {
+  size_type word = 0;
+  if (indexed_) {
+    if (k >= ones_) throw std::out_of_range("Rank out of range");
+    // Binary search for the last block starting at or before the k-th one,
+    // between the samples around it.
+    size_type sample = k / kSelectSample;
+    size_type low = select_samples_[sample];
+    size_type high = (sample + 1 < select_samples_.size()
+                          ? select_samples_[sample + 1] + 1
+                          : rank_blocks_.size() - 1);
+    while (high - low > 1) {
+      size_type middle = low + (high - low) / 2;
+      if (rank_blocks_[middle] <= k) {
+        low = middle;
+      } else {
+        high = middle;
+      }
+    }
+    k -= rank_blocks_[low];
+    word = low * kBlockWords;
+  }
+  for (; word < words_.size(); ++word) {
+    size_type ones = detail::popcount64(words_[word]);
+    if (k < ones) return word * kWordBits + select_in_word(words_[word], k);
+    k -= ones;
+  }
+  throw std::out_of_range("Rank out of range");
+}
+
+// ADDITIONAL FUNCTIONS
+
+inline bit_vector::word_type bit_vector::tail_mask() const noexcept {
+  return (size_ % kWordBits == 0 ? ~word_type(0)
+                                 : ~(~word_type(0) << (size_ % kWordBits)));
+}
+
+inline void bit_vector::clear_tail() noexcept {
+  if (!words_.empty()) words_[words_.size() - 1] &= tail_mask();
+}
+
+inline void bit_vector::check_size(const bit_vector &other) const {
+  if (size_ != other.size_) {
+    throw std::invalid_argument("bit_vector sizes differ");
+  }
+}
+
+inline bit_vector::size_type bit_vector::select_in_word(word_type word,
+                                                        size_type k) noexcept {
+  for (; k > 0; --k) word &= word - 1;
+  return detail::countr_zero64(word);
+}
+
+inline bool operator==(const bit_vector &a, const bit_vector &b) {
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.word_count(); ++i) {
+    if (a.words()[i] != b.words()[i]) return false;
+  }
+  return true;
+}
+
+inline bool operator!=(const bit_vector &a, const bit_vector &b) {
+  return !(a == b);
+}
+
+inline bit_vector operator&(bit_vector a, const bit_vector &b) {
+  return a &= b;
+}
+
+inline bit_vector operator|(bit_vector a, const bit_vector &b) {
+  return a |= b;
+}
+
+inline bit_vector operator^(bit_vector a, const bit_vector &b) {
+  return a ^= b;
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERSPLUS_S21_BIT_VECTOR_H
@@ -1,2 +1,15 @@
 #include "s21_array.h"
-#include "s21_multiset.h"
\ No newline at end of file
+#include "s21_bit_vector.h"
+#include "s21_hugepage_allocator.h"
+#include "s21_interval_map.h"
+#include "s21_mapped_vector.h"
+#include "s21_multiset.h"
+#include "s21_parallel.h"
+#include "s21_pmr.h"
+#include "s21_radix_sort.h"
+#include "s21_segmented_vector.h"
+#include "s21_simd.h"
+#include "s21_small_vector.h"
+#include "s21_soa_vector.h"
+#include "s21_span.h"
+#include "s21_thread_pool.h"
\ No newline at end of file
@@ -0,0 +1,145 @@
+#ifndef S21_CONTAINERSPLUS_S21_HUGEPAGE_ALLOCATOR_H
+#define S21_CONTAINERSPLUS_S21_HUGEPAGE_ALLOCATOR_H
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace s21 {
+// Where the pages of a large buffer are placed on a NUMA machine. bind and
+// interleave use the nodes of hugepage_options::node_mask.
+enum class numa_policy { local, bind, interleave };
+
+struct hugepage_options {
+  // Buffers smaller than this come from operator new.
+  size_t threshold = size_t(1) << 21;
+  // Reserve explicit 2MB pages with MAP_HUGETLB before falling back to
+  // transparent huge pages.
+  bool explicit_pages = false;
+  numa_policy policy = numa_policy::local;
+  unsigned long node_mask = 0;
+};
+
+inline bool operator==(const hugepage_options &a, const hugepage_options &b) {
+  return a.threshold == b.threshold && a.explicit_pages == b.explicit_pages &&
+         a.policy == b.policy && a.node_mask == b.node_mask;
+}
+
+// Allocator for very large vectors. Big buffers are mapped directly and
+// backed by 2MB pages, which cuts TLB misses on scans over them. Explicit
+// huge pages are tried first when asked for. Otherwise, or when none are
+// reserved, the mapping is marked for transparent huge pages. Systems
+// without mmap, and buffers below the threshold, use operator new. A NUMA
+// policy that the kernel rejects is ignored.
+template <typename T>
+class hugepage_allocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  static constexpr size_t kHugePageSize = size_t(1) << 21;
+
+  hugepage_allocator() noexcept = default;
+  explicit hugepage_allocator(const hugepage_options &options) noexcept
+      : options_(options) {}
+  template <typename U>
+  hugepage_allocator(const hugepage_allocator<U> &other) noexcept
+      : options_(other.options()) {}
+
+  T *allocate(size_t n) {
+    if (n > (std::numeric_limits<size_t>::max() - kHugePageSize) / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    size_t bytes = n * sizeof(T);
+#if defined(__linux__)
+    if (bytes >= options_.threshold) return static_cast<T *>(map(bytes));
+#endif
+    return static_cast<T *>(
+        ::operator new(bytes, std::align_val_t(alignof(T))));
+  }
+
+  void deallocate(T *p, size_t n) noexcept {
+    size_t bytes = n * sizeof(T);
+#if defined(__linux__)
+    if (bytes >= options_.threshold) {
+      munmap(p, round_up(bytes));
+      return;
+    }
+#endif
+    ::operator delete(p, bytes, std::align_val_t(alignof(T)));
+  }
+
+  const hugepage_options &options() const noexcept { return options_; }
+
+ private:
+  hugepage_options options_;
+
+  static size_t round_up(size_t bytes) {
+    return (bytes + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+  }
+
+#if defined(__linux__)
+  void *map(size_t bytes) const {
+    size_t length = round_up(bytes);
+    void *p = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+    if (options_.explicit_pages) {
+      p = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#endif
+    if (p == MAP_FAILED) {
+      p = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (p == MAP_FAILED) throw std::bad_alloc();
+#if defined(MADV_HUGEPAGE)
+      madvise(p, length, MADV_HUGEPAGE);
+#endif
+    }
+    place(p, length);
+    return p;
+  }
+
+  // Applies the NUMA policy with the raw mbind system call, so no libnuma
+  // is needed. The pages are not touched yet, so they are placed on first
+  // use.
+  void place([[maybe_unused]] void *p, [[maybe_unused]] size_t length) const {
+#if defined(SYS_mbind)
+    if (options_.policy == numa_policy::local || options_.node_mask == 0) {
+      return;
+    }
+    const long kMpolBind = 2;
+    const long kMpolInterleave = 3;
+    long mode =
+        (options_.policy == numa_policy::bind ? kMpolBind : kMpolInterleave);
+    unsigned long mask = options_.node_mask;
+    syscall(SYS_mbind, p, length, mode, &mask,
+            sizeof(mask) * std::numeric_limits<unsigned char>::digits, 0);
+#endif
+  }
+#endif
+};
+
+template <typename T, typename U>
+inline bool operator==(const hugepage_allocator<T> &a,
+                       const hugepage_allocator<U> &b) noexcept {
+  return a.options() == b.options();
+}
+
+template <typename T, typename U>
+inline bool operator!=(const hugepage_allocator<T> &a,
+                       const hugepage_allocator<U> &b) noexcept {
+  return !(a == b);
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERSPLUS_S21_HUGEPAGE_ALLOCATOR_H
@@ -0,0 +1,208 @@
+#ifndef S21_CONTAINERSPLUS_S21_INTERVAL_MAP_H
+#define S21_CONTAINERSPLUS_S21_INTERVAL_MAP_H
+
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_containers/RBTree.h"
+#include "../s21_containers/s21_vector.h"
+
+namespace s21 {
+// Keeps the largest interval end of every subtree in the node, which lets the
+// overlap queries skip subtrees that end before the queried range.
+template <typename Key>
+struct interval_augment {
+  using value_type = Key;
+  static constexpr bool enabled = true;
+  template <typename Node>
+  static void update(Node *node) {
+    node->aug = node->key.second;
+    if (node->left != nullptr && node->aug < node->left->aug)
+      node->aug = node->left->aug;
+    if (node->right != nullptr && node->aug < node->right->aug)
+      node->aug = node->right->aug;
+  }
+};
+
+// Maps closed intervals [first, second] to values. Intervals are ordered by
+// start and then by end, and each distinct interval is stored once.
+template <typename Key, typename T>
+class interval_map
+    : public RBTree<std::pair<Key, Key>, T, interval_augment<Key>> {
+ public:
+  using key_type = Key;
+  using interval_type = std::pair<Key, Key>;
+  using mapped_type = T;
+  using value_type = std::pair<const interval_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using tree_type = Tree<interval_type, T, interval_augment<Key>>;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
+
+  interval_map()
+      : RBTree<interval_type, mapped_type, interval_augment<Key>>(){};
+  interval_map(std::initializer_list<value_type> const &items);
+  interval_map(const interval_map &m)
+      : RBTree<interval_type, mapped_type, interval_augment<Key>>(m){};
+  interval_map(interval_map &&m) noexcept
+      : RBTree<interval_type, mapped_type, interval_augment<Key>>(
+            std::move(m)){};
+  ~interval_map() = default;
+  interval_map &operator=(interval_map &&other) noexcept;
+  interval_map &operator=(const interval_map &other);
+
+  bool empty();
+  size_type size();
+  size_type max_size() noexcept;
+
+  bool contains(const Key &lo, const Key &hi);
+  iterator find(const Key &lo, const Key &hi);
+
+  void clear();
+  [[maybe_unused]] std::pair<iterator, bool> insert(const value_type &value);
+  [[maybe_unused]] std::pair<iterator, bool> insert(const Key &lo,
+                                                    const Key &hi,
+                                                    const T &obj);
+  void erase(iterator pos);
+  bool erase(const Key &lo, const Key &hi);
+  void swap(interval_map &other);
+
+  s21::vector<iterator> overlapping(const Key &lo, const Key &hi);
+  s21::vector<iterator> stabbing(const Key &point);
+
+ private:
+  using node_type = typename tree_type::Node;
+};
+
+template <typename Key, typename T>
+interval_map<Key, T>::interval_map(
+    std::initializer_list<value_type> const &items) {
+  for (const value_type &item : items) insert(item);
+}
+
+template <typename Key, typename T>
+inline interval_map<Key, T> &interval_map<Key, T>::operator=(
+    interval_map &&other) noexcept {
+  tree_type::operator=(std::move(other));
+  return *this;
+}
+
+template <typename Key, typename T>
+inline interval_map<Key, T> &interval_map<Key, T>::operator=(
+    const interval_map &other) {
+  if (this != &other) {
+    interval_map temp(other);
+    clear();
+    *this = std::move(temp);
+  }
+  return *this;
+}
+
+template <typename Key, typename T>
+inline bool interval_map<Key, T>::empty() {
+  return tree_type::isempty();
+}
+
+template <typename Key, typename T>
+inline typename interval_map<Key, T>::size_type interval_map<Key, T>::size() {
+  return tree_type::sizeofTree();
+}
+
+template <typename Key, typename T>
+inline typename interval_map<Key, T>::size_type
+interval_map<Key, T>::max_size() noexcept {
+  return std::numeric_limits<size_type>::max() / sizeof(node_type);
+}
+
+template <typename Key, typename T>
+inline bool interval_map<Key, T>::contains(const Key &lo, const Key &hi) {
+  return tree_type::search(interval_type(lo, hi)) != nullptr;
+}
+
+template <typename Key, typename T>
+inline typename interval_map<Key, T>::iterator interval_map<Key, T>::find(
+    const Key &lo, const Key &hi) {
+  node_type *node = tree_type::search(interval_type(lo, hi));
+  return node == nullptr ? tree_type::end() : iterator(this, node);
+}
+
+template <typename Key, typename T>
+inline void interval_map<Key, T>::clear() {
+  tree_type::clear();
+}
+
+template <typename Key, typename T>
+inline std::pair<typename interval_map<Key, T>::iterator, bool>
+interval_map<Key, T>::insert(const value_type &value) {
+  return insert(value.first.first, value.first.second, value.second);
+}
+
+template <typename Key, typename T>
+inline std::pair<typename interval_map<Key, T>::iterator, bool>
+interval_map<Key, T>::insert(const Key &lo, const Key &hi, const T &obj) {
+  if (hi < lo) throw std::invalid_argument("Interval ends before it starts");
+  interval_type interval(lo, hi);
+  if (tree_type::search(interval) != nullptr)
+    return std::make_pair(tree_type::end(), false);
+  tree_type::insert(interval, obj);
+  RBTree<interval_type, T, interval_augment<Key>>::fixInsert(interval);
+  return std::make_pair(iterator(this, tree_type::search(interval)), true);
+}
+
+template <typename Key, typename T>
+inline void interval_map<Key, T>::erase(iterator pos) {
+  RBTree<interval_type, T, interval_augment<Key>>::remove((*pos).first);
+}
+
+template <typename Key, typename T>
+inline bool interval_map<Key, T>::erase(const Key &lo, const Key &hi) {
+  if (!contains(lo, hi)) return false;
+  RBTree<interval_type, T, interval_augment<Key>>::remove(
+      interval_type(lo, hi));
+  return true;
+}
+
+template <typename Key, typename T>
+inline void interval_map<Key, T>::swap(interval_map &other) {
+  tree_type::swap(other);
+}
+
+// Returns the intervals intersecting [lo, hi] in order. The in-order walk
+// skips every subtree whose largest end lies before lo and stops at the first
+// interval starting after hi. A subtree is entered only when it holds an
+// interval ending at or after lo, and each one entered costs at most one
+// root-to-leaf path before it yields a match or is left, so k results take
+// O(min(n, (k + 1) log n)), not the O(log n + k) of a priority search tree.
+template <typename Key, typename T>
+s21::vector<typename interval_map<Key, T>::iterator>
+interval_map<Key, T>::overlapping(const Key &lo, const Key &hi) {
+  s21::vector<iterator> found;
+  s21::vector<node_type *> stack;
+  node_type *cur = tree_type::root;
+  while (cur != nullptr || !stack.empty()) {
+    while (cur != nullptr && !(cur->aug < lo)) {
+      stack.push_back(cur);
+      cur = cur->left;
+    }
+    if (stack.empty()) break;
+    cur = stack.back();
+    stack.pop_back();
+    if (hi < cur->key.first) break;
+    if (!(cur->key.second < lo)) found.push_back(iterator(this, cur));
+    cur = cur->right;
+  }
+  return found;
+}
+
+template <typename Key, typename T>
+inline s21::vector<typename interval_map<Key, T>::iterator>
+interval_map<Key, T>::stabbing(const Key &point) {
+  return overlapping(point, point);
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERSPLUS_S21_INTERVAL_MAP_H
@@ -0,0 +1,420 @@
+#ifndef S21_CONTAINERSPLUS_S21_MAPPED_VECTOR_H
+#define S21_CONTAINERSPLUS_S21_MAPPED_VECTOR_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// How a mapped_vector opens its file.
+//  read_only  - the elements can only be read: every accessor gives const
+//               elements, so writes to the read-only mapping do not compile.
+//  read_write - the file is created if needed, and changes and growth are
+//               written back to it and seen by every process mapping it.
+//  copy_on_write - the file is read, but changes stay private to this
+//               vector and the size is fixed.
+enum class map_mode { read_only, read_write, copy_on_write };
+
+// A vector whose elements live in a memory-mapped file, so loading the file
+// is a single mmap. The file holds the raw elements back to back. While a
+// read_write vector is open the file may be longer than size(); it is cut
+// back to the elements when the vector is closed. The mode is part of the
+// type.
+template <typename T, map_mode Mode = map_mode::read_only>
+class mapped_vector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "mapped_vector stores the raw bytes of its elements");
+
+ public:
+  using value_type = T;
+  using reference =
+      std::conditional_t<Mode == map_mode::read_only, const T &, T &>;
+  using const_reference = const T &;
+  using iterator =
+      std::conditional_t<Mode == map_mode::read_only, const T *, T *>;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  mapped_vector() = default;
+  explicit mapped_vector(const std::string &path);
+  mapped_vector(const mapped_vector &) = delete;
+  mapped_vector(mapped_vector &&v) noexcept;
+  ~mapped_vector();
+
+  mapped_vector &operator=(const mapped_vector &) = delete;
+  mapped_vector &operator=(mapped_vector &&v) noexcept;
+
+  void open(const std::string &path);
+  void close();
+  bool is_open() const noexcept;
+  static constexpr map_mode mode() noexcept { return Mode; }
+  void flush();
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+
+  reference front();
+  const_reference front() const;
+
+  reference back();
+  const_reference back() const;
+
+  iterator data() noexcept;
+  const_iterator data() const noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const;
+  size_type capacity() const;
+  void reserve(size_type new_capacity);
+  void resize(size_type count);
+  void shrink_to_fit();
+
+  void clear();
+  void push_back(const_reference value);
+  void pop_back();
+  void swap(mapped_vector &other) noexcept;
+
+ private:
+  int fd_ = -1;
+  value_type *data_ = nullptr;
+  size_type size_ = 0;
+  size_type capacity_ = 0;
+
+  void check_writable() const;
+  void remap(size_type new_capacity);
+  [[noreturn]] static void throw_errno(const char *what);
+};
+
+template <typename T, map_mode Mode>
+inline mapped_vector<T, Mode>::mapped_vector(const std::string &path) {
+  open(path);
+}
+
+template <typename T, map_mode Mode>
+inline mapped_vector<T, Mode>::mapped_vector(mapped_vector &&v) noexcept {
+  swap(v);
+}
+
+template <typename T, map_mode Mode>
+inline mapped_vector<T, Mode>::~mapped_vector() {
+  try {
+    close();
+  } catch (...) {
+  }
+}
+
+template <typename T, map_mode Mode>
+inline mapped_vector<T, Mode> &mapped_vector<T, Mode>::operator=(
+    mapped_vector &&v) noexcept {
+  if (this != &v) {
+    mapped_vector temp(std::move(v));
+    swap(temp);
+  }
+  return *this;
+}
+
+template <typename T, map_mode Mode>
+void mapped_vector<T, Mode>::open(const std::string &path) {
+  close();
+  int flags = (Mode == map_mode::read_write ? O_RDWR | O_CREAT : O_RDONLY);
+  int fd = ::open(path.c_str(), flags, 0644);
+  if (fd < 0) throw_errno("Cannot open mapped file");
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    int error = errno;
+    ::close(fd);
+    errno = error;
+    throw_errno("Cannot stat mapped file");
+  }
+  // close() cuts the file back to whole elements, which would drop the
+  // bytes of a partial one.
+  if (static_cast<size_type>(info.st_size) % sizeof(value_type) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Mapped file is not a whole number of elements");
+  }
+  size_type count = static_cast<size_type>(info.st_size) / sizeof(value_type);
+  fd_ = fd;
+  try {
+    remap(count);
+  } catch (...) {
+    ::close(fd_);
+    fd_ = -1;
+    throw;
+  }
+  size_ = count;
+}
+
+// Cuts the file back to the stored elements and unmaps it.
+template <typename T, map_mode Mode>
+void mapped_vector<T, Mode>::close() {
+  if (fd_ < 0) return;
+  if (data_ != nullptr) munmap(data_, capacity_ * sizeof(value_type));
+  int result = 0;
+  if (Mode == map_mode::read_write) {
+    result = ftruncate(fd_, static_cast<off_t>(size_ * sizeof(value_type)));
+  }
+  ::close(fd_);
+  fd_ = -1;
+  data_ = nullptr;
+  size_ = 0;
+  capacity_ = 0;
+  if (result != 0) throw_errno("Cannot resize mapped file");
+}
+
+template <typename T, map_mode Mode>
+inline bool mapped_vector<T, Mode>::is_open() const noexcept {
+  return fd_ >= 0;
+}
+
+// Writes the changed pages back to the file now instead of whenever the
+// kernel gets to them.
+template <typename T, map_mode Mode>
+inline void mapped_vector<T, Mode>::flush() {
+  if (Mode == map_mode::read_write && data_ != nullptr &&
+      msync(data_, capacity_ * sizeof(value_type), MS_SYNC) != 0) {
+    throw_errno("Cannot flush mapped file");
+  }
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::reference
+mapped_vector<T, Mode>::at(size_type pos) {
+  return (pos >= size_ ? throw std::out_of_range("Index out of range")
+                       : data_[pos]);
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::const_reference
+mapped_vector<T, Mode>::at(size_type pos) const {
+  return (pos >= size_ ? throw std::out_of_range("Index out of range")
+                       : data_[pos]);
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::reference
+mapped_vector<T, Mode>::operator[](size_type pos) {
+  return data_[pos];
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::const_reference
+mapped_vector<T, Mode>::operator[](size_type pos) const {
+  return data_[pos];
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::reference
+mapped_vector<T, Mode>::front() {
+  return (size_ > 0 ? data_[0] : throw std::out_of_range("Index out of range"));
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::const_reference
+mapped_vector<T, Mode>::front() const {
+  return (size_ > 0 ? data_[0] : throw std::out_of_range("Index out of range"));
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::reference
+mapped_vector<T, Mode>::back() {
+  return (size_ > 0 ? data_[size_ - 1]
+                    : throw std::out_of_range("Index out of range"));
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::const_reference
+mapped_vector<T, Mode>::back() const {
+  return (size_ > 0 ? data_[size_ - 1]
+                    : throw std::out_of_range("Index out of range"));
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::iterator
+mapped_vector<T, Mode>::data() noexcept {
+  return data_;
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::const_iterator
+mapped_vector<T, Mode>::data() const noexcept {
+  return data_;
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::iterator
+mapped_vector<T, Mode>::begin() noexcept {
+  return data_;
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::const_iterator
+mapped_vector<T, Mode>::begin() const noexcept {
+  return data_;
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::iterator
+mapped_vector<T, Mode>::end() noexcept {
+  return data_ + size_;
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::const_iterator
+mapped_vector<T, Mode>::end() const noexcept {
+  return data_ + size_;
+}
+
+template <typename T, map_mode Mode>
+inline bool mapped_vector<T, Mode>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::size_type
+mapped_vector<T, Mode>::size() const {
+  return size_;
+}
+
+template <typename T, map_mode Mode>
+inline typename mapped_vector<T, Mode>::size_type
+mapped_vector<T, Mode>::capacity() const {
+  return capacity_;
+}
+
+template <typename T, map_mode Mode>
+inline void mapped_vector<T, Mode>::reserve(size_type new_capacity) {
+  if (new_capacity <= capacity_) return;
+  check_writable();
+  remap(new_capacity);
+}
+
+// New elements are zero bytes, like the space a grown file gets.
+template <typename T, map_mode Mode>
+void mapped_vector<T, Mode>::resize(size_type count) {
+  check_writable();
+  if (count > capacity_) remap(count);
+  if (count > size_) {
+    std::memset(static_cast<void *>(data_ + size_), 0,
+                (count - size_) * sizeof(value_type));
+  }
+  size_ = count;
+}
+
+template <typename T, map_mode Mode>
+inline void mapped_vector<T, Mode>::shrink_to_fit() {
+  if (size_ < capacity_) {
+    check_writable();
+    remap(size_);
+  }
+}
+
+template <typename T, map_mode Mode>
+inline void mapped_vector<T, Mode>::clear() {
+  resize(0);
+}
+
+template <typename T, map_mode Mode>
+inline void mapped_vector<T, Mode>::push_back(const_reference value) {
+  if (size_ == capacity_) {
+    check_writable();
+    value_type copy = value;
+    remap(capacity_ > 0 ? capacity_ * 2
+                        : std::max<size_type>(1, 4096 / sizeof(value_type)));
+    data_[size_++] = copy;
+  } else {
+    check_writable();
+    data_[size_++] = value;
+  }
+}
+
+template <typename T, map_mode Mode>
+inline void mapped_vector<T, Mode>::pop_back() {
+  if (!empty()) resize(size_ - 1);
+}
+
+template <typename T, map_mode Mode>
+inline void mapped_vector<T, Mode>::swap(mapped_vector &other) noexcept {
+  std::swap(fd_, other.fd_);
+  std::swap(data_, other.data_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+}
+
+// ADDITIONAL FUNCTIONS
+
+template <typename T, map_mode Mode>
+inline void mapped_vector<T, Mode>::check_writable() const {
+  if (fd_ < 0) throw std::logic_error("mapped_vector is not open");
+  if (Mode != map_mode::read_write) {
+    throw std::logic_error("mapped_vector cannot change its size");
+  }
+}
+
+// Resizes the file to new_capacity elements and maps all of it. Linux moves
+// the existing mapping with mremap; elsewhere the file is mapped again and
+// the old mapping is dropped only once the new one exists. The file grows
+// before the mapping does and shrinks after it, so no mapped page is ever
+// past the end of the file.
+template <typename T, map_mode Mode>
+void mapped_vector<T, Mode>::remap(size_type new_capacity) {
+  size_t old_bytes = capacity_ * sizeof(value_type);
+  size_t new_bytes = new_capacity * sizeof(value_type);
+  bool resizes_file = Mode == map_mode::read_write;
+  if (resizes_file && new_bytes > old_bytes &&
+      ftruncate(fd_, static_cast<off_t>(new_bytes)) != 0) {
+    throw_errno("Cannot resize mapped file");
+  }
+  void *p = nullptr;
+  bool moved = false;
+#if defined(__linux__)
+  if (data_ != nullptr && new_bytes > 0) {
+    p = mremap(data_, old_bytes, new_bytes, MREMAP_MAYMOVE);
+    moved = true;
+  }
+#endif
+  if (!moved && new_bytes > 0) {
+    int prot = PROT_READ;
+    int flags = MAP_SHARED;
+    if (Mode == map_mode::read_write) prot |= PROT_WRITE;
+    if (Mode == map_mode::copy_on_write) {
+      prot |= PROT_WRITE;
+      flags = MAP_PRIVATE;
+    }
+    p = mmap(nullptr, new_bytes, prot, flags, fd_, 0);
+  }
+  if (p == MAP_FAILED) throw_errno("Cannot map file");
+  if (!moved && data_ != nullptr) munmap(data_, old_bytes);
+  data_ = static_cast<value_type *>(p);
+  capacity_ = new_capacity;
+  if (resizes_file && new_bytes < old_bytes &&
+      ftruncate(fd_, static_cast<off_t>(new_bytes)) != 0) {
+    throw_errno("Cannot resize mapped file");
+  }
+}
+
+template <typename T, map_mode Mode>
+inline void mapped_vector<T, Mode>::throw_errno(const char *what) {
+  throw std::system_error(errno, std::generic_category(), what);
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERSPLUS_S21_MAPPED_VECTOR_H
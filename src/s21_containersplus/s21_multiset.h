@@ -60,10 +60,7 @@ multiset<Key>::multiset(
 
 template <typename Key>
 inline multiset<Key> &multiset<Key>::operator=(multiset &&other) noexcept {
-  if (this != &other) {
-    Tree<Key, Key>::root = other.root;
-    other.root = nullptr;
-  }
+  Tree<Key, Key>::operator=(std::move(other));
   return *this;
 }
 
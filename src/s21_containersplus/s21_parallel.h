@@ -0,0 +1,374 @@
+#ifndef S21_CONTAINERSPLUS_S21_PARALLEL_H
+#define S21_CONTAINERSPLUS_S21_PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_containers/s21_vector.h"
+#include "s21_thread_pool.h"
+
+// Parallel versions of the standard sort, for_each, transform, reduce and
+// scans over random-access ranges such as those of s21::vector and
+// s21::array. Each splits the range into a few chunks per thread, runs them
+// as a task_group on a thread_pool (the default pool unless one is passed
+// first) and rethrows the first exception a chunk threw. Ranges shorter
+// than kSequentialCutoff are handled by the sequential algorithm.
+//
+// As with std::reduce, the operations of reduce and the scans must be
+// associative; they are applied in an unspecified grouping but never
+// reorder the operands.
+namespace s21 {
+namespace parallel {
+constexpr size_t kSequentialCutoff = size_t(1) << 14;
+
+namespace detail {
+template <typename It>
+using require_random_access = std::enable_if_t<std::is_base_of<
+    std::random_access_iterator_tag,
+    typename std::iterator_traits<It>::iterator_category>::value>;
+
+// Chunk boundaries: chunk i is [bounds[i], bounds[i + 1]).
+inline s21::vector<size_t> split(size_t size, size_t chunks) {
+  s21::vector<size_t> bounds;
+  bounds.reserve(chunks + 1);
+  for (size_t i = 0; i <= chunks; ++i) bounds.push_back(size * i / chunks);
+  return bounds;
+}
+
+// Four chunks per thread, counting the caller, so that uneven chunks even
+// out; one chunk when the range is too short to be worth splitting.
+inline size_t chunk_count(const thread_pool &pool, size_t size,
+                          size_t per_thread = 4) {
+  if (size < kSequentialCutoff) return 1;
+  size_t chunks = (pool.size() + 1) * per_thread;
+  return std::min(chunks, size / (kSequentialCutoff / 4));
+}
+
+// Calls function(i) for every i below count, i == 0 on the calling thread.
+template <typename Function>
+void for_each_index(thread_pool &pool, size_t count, Function &function) {
+  if (count == 1) {
+    function(size_t(0));
+    return;
+  }
+  task_group group(pool);
+  std::exception_ptr error;
+  try {
+    for (size_t i = 1; i < count; ++i) {
+      group.run([&function, i] { function(i); });
+    }
+    function(size_t(0));
+  } catch (...) {
+    error = std::current_exception();
+  }
+  // The tasks refer to this frame, so they are joined before any rethrow.
+  try {
+    group.wait();
+  } catch (...) {
+    if (!error) error = std::current_exception();
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+// Uninitialized storage for a range being sorted; destroys what it holds.
+template <typename T>
+class merge_buffer {
+ public:
+  explicit merge_buffer(size_t size)
+      : data_(std::allocator<T>().allocate(size)), size_(size) {}
+  merge_buffer(const merge_buffer &) = delete;
+  merge_buffer &operator=(const merge_buffer &) = delete;
+  ~merge_buffer() {
+    std::destroy(data_, data_ + constructed_);
+    std::allocator<T>().deallocate(data_, size_);
+  }
+
+  T *data() const noexcept { return data_; }
+  void set_constructed(size_t count) noexcept { constructed_ = count; }
+
+ private:
+  T *data_;
+  size_t size_;
+  size_t constructed_ = 0;
+};
+
+// One piece of a merge: source [a, a_end) with [b, b_end) into out.
+struct merge_piece {
+  size_t a, a_end, b, b_end, out;
+};
+
+// Merges neighbouring runs of from into to, a round of the merge sort.
+// Every pair is cut into pieces that can be merged on their own: piece
+// boundaries are taken evenly in the first run and found in the second
+// with lower_bound. An unpaired last run is moved over as it is.
+template <typename From, typename To, typename Compare>
+void merge_round(thread_pool &pool, From from, To to,
+                 const s21::vector<size_t> &bounds, size_t pieces_per_pair,
+                 Compare &comp) {
+  size_t runs = bounds.size() - 1;
+  s21::vector<merge_piece> pieces;
+  for (size_t run = 0; run + 1 < runs; run += 2) {
+    size_t a = bounds[run], mid = bounds[run + 1], end = bounds[run + 2];
+    size_t b = mid;
+    for (size_t piece = 1; piece <= pieces_per_pair; ++piece) {
+      size_t a_end = piece == pieces_per_pair
+                         ? mid
+                         : bounds[run] + (mid - bounds[run]) * piece /
+                                             pieces_per_pair;
+      size_t b_end =
+          piece == pieces_per_pair || a_end == mid
+              ? end
+              : size_t(std::lower_bound(from + b, from + end, from[a_end],
+                                        comp) -
+                       from);
+      pieces.push_back(merge_piece{a, a_end, b, b_end, a + b - mid});
+      a = a_end;
+      b = b_end;
+      if (a == mid) break;
+    }
+  }
+  if (runs % 2) {
+    size_t last = bounds[runs - 1];
+    pieces.push_back(merge_piece{last, bounds[runs], bounds[runs],
+                                 bounds[runs], last});
+  }
+  auto merge = [&](size_t i) {
+    const merge_piece &piece = pieces[i];
+    std::merge(std::make_move_iterator(from + piece.a),
+               std::make_move_iterator(from + piece.a_end),
+               std::make_move_iterator(from + piece.b),
+               std::make_move_iterator(from + piece.b_end), to + piece.out,
+               comp);
+  };
+  for_each_index(pool, pieces.size(), merge);
+}
+}  // namespace detail
+
+template <typename RandomIt, typename Function,
+          typename = detail::require_random_access<RandomIt>>
+void for_each(thread_pool &pool, RandomIt first, RandomIt last,
+              Function function) {
+  size_t size = size_t(last - first);
+  size_t chunks = detail::chunk_count(pool, size);
+  s21::vector<size_t> bounds = detail::split(size, chunks);
+  auto body = [&](size_t i) {
+    std::for_each(first + bounds[i], first + bounds[i + 1], function);
+  };
+  detail::for_each_index(pool, chunks, body);
+}
+
+template <typename RandomIt, typename Function,
+          typename = detail::require_random_access<RandomIt>>
+void for_each(RandomIt first, RandomIt last, Function function) {
+  parallel::for_each(thread_pool::default_pool(), first, last, function);
+}
+
+template <typename RandomIt, typename OutputIt, typename Function,
+          typename = detail::require_random_access<RandomIt>,
+          typename = detail::require_random_access<OutputIt>>
+OutputIt transform(thread_pool &pool, RandomIt first, RandomIt last,
+                   OutputIt d_first, Function function) {
+  size_t size = size_t(last - first);
+  size_t chunks = detail::chunk_count(pool, size);
+  s21::vector<size_t> bounds = detail::split(size, chunks);
+  auto body = [&](size_t i) {
+    std::transform(first + bounds[i], first + bounds[i + 1],
+                   d_first + bounds[i], function);
+  };
+  detail::for_each_index(pool, chunks, body);
+  return d_first + size;
+}
+
+template <typename RandomIt, typename OutputIt, typename Function,
+          typename = detail::require_random_access<RandomIt>,
+          typename = detail::require_random_access<OutputIt>>
+OutputIt transform(RandomIt first, RandomIt last, OutputIt d_first,
+                   Function function) {
+  return parallel::transform(thread_pool::default_pool(), first, last,
+                             d_first, function);
+}
+
+// Each chunk is folded on its own, the first one starting from init, and
+// the chunk results are folded left to right.
+template <typename RandomIt, typename T, typename BinaryOp = std::plus<>,
+          typename = detail::require_random_access<RandomIt>>
+T reduce(thread_pool &pool, RandomIt first, RandomIt last, T init,
+         BinaryOp op = BinaryOp()) {
+  size_t size = size_t(last - first);
+  size_t chunks = detail::chunk_count(pool, size);
+  if (chunks == 1) return std::accumulate(first, last, std::move(init), op);
+  s21::vector<size_t> bounds = detail::split(size, chunks);
+  s21::vector<T> partial;
+  partial.reserve(chunks);
+  for (size_t i = 0; i < chunks; ++i) partial.push_back(init);
+  auto body = [&](size_t i) {
+    RandomIt begin = first + bounds[i], end = first + bounds[i + 1];
+    partial[i] = i == 0 ? std::accumulate(begin, end, partial[i], op)
+                        : std::accumulate(begin + 1, end, T(*begin), op);
+  };
+  detail::for_each_index(pool, chunks, body);
+  T result = std::move(partial[0]);
+  for (size_t i = 1; i < chunks; ++i) {
+    result = op(std::move(result), partial[i]);
+  }
+  return result;
+}
+
+template <typename RandomIt, typename T, typename BinaryOp = std::plus<>,
+          typename = detail::require_random_access<RandomIt>>
+T reduce(RandomIt first, RandomIt last, T init, BinaryOp op = BinaryOp()) {
+  return parallel::reduce(thread_pool::default_pool(), first, last,
+                          std::move(init), op);
+}
+
+// Both scans take three passes: the chunks are reduced in parallel, the
+// chunk totals are scanned into starting values on the calling thread,
+// and the chunks are scanned in parallel from those. They may scan a
+// range onto itself.
+template <typename RandomIt, typename OutputIt, typename T,
+          typename BinaryOp = std::plus<>,
+          typename = detail::require_random_access<RandomIt>,
+          typename = detail::require_random_access<OutputIt>>
+OutputIt exclusive_scan(thread_pool &pool, RandomIt first, RandomIt last,
+                        OutputIt d_first, T init, BinaryOp op = BinaryOp()) {
+  size_t size = size_t(last - first);
+  size_t chunks = detail::chunk_count(pool, size);
+  if (chunks == 1) {
+    return std::exclusive_scan(first, last, d_first, std::move(init), op);
+  }
+  s21::vector<size_t> bounds = detail::split(size, chunks);
+  s21::vector<T> start;
+  start.reserve(chunks);
+  for (size_t i = 0; i < chunks; ++i) start.push_back(init);
+  auto totals = [&](size_t i) {
+    if (i + 1 == chunks) return;
+    RandomIt begin = first + bounds[i], end = first + bounds[i + 1];
+    start[i + 1] = std::accumulate(begin + 1, end, T(*begin), op);
+  };
+  detail::for_each_index(pool, chunks, totals);
+  for (size_t i = 1; i < chunks; ++i) start[i] = op(start[i - 1], start[i]);
+  auto scan = [&](size_t i) {
+    std::exclusive_scan(first + bounds[i], first + bounds[i + 1],
+                        d_first + bounds[i], start[i], op);
+  };
+  detail::for_each_index(pool, chunks, scan);
+  return d_first + size;
+}
+
+template <typename RandomIt, typename OutputIt, typename T,
+          typename BinaryOp = std::plus<>,
+          typename = detail::require_random_access<RandomIt>,
+          typename = detail::require_random_access<OutputIt>>
+OutputIt exclusive_scan(RandomIt first, RandomIt last, OutputIt d_first,
+                        T init, BinaryOp op = BinaryOp()) {
+  return parallel::exclusive_scan(thread_pool::default_pool(), first, last,
+                                  d_first, std::move(init), op);
+}
+
+template <typename RandomIt, typename OutputIt,
+          typename BinaryOp = std::plus<>,
+          typename = detail::require_random_access<RandomIt>,
+          typename = detail::require_random_access<OutputIt>>
+OutputIt inclusive_scan(thread_pool &pool, RandomIt first, RandomIt last,
+                        OutputIt d_first, BinaryOp op = BinaryOp()) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  size_t size = size_t(last - first);
+  size_t chunks = detail::chunk_count(pool, size);
+  if (chunks == 1) return std::inclusive_scan(first, last, d_first, op);
+  s21::vector<size_t> bounds = detail::split(size, chunks);
+  s21::vector<T> start;
+  start.reserve(chunks);
+  for (size_t i = 0; i < chunks; ++i) start.push_back(first[bounds[i]]);
+  auto totals = [&](size_t i) {
+    if (i + 1 == chunks) return;
+    RandomIt begin = first + bounds[i], end = first + bounds[i + 1];
+    start[i + 1] = std::accumulate(begin + 1, end, T(*begin), op);
+  };
+  detail::for_each_index(pool, chunks, totals);
+  for (size_t i = 2; i < chunks; ++i) start[i] = op(start[i - 1], start[i]);
+  auto scan = [&](size_t i) {
+    RandomIt begin = first + bounds[i], end = first + bounds[i + 1];
+    if (i == 0) {
+      std::inclusive_scan(begin, end, d_first, op);
+    } else {
+      std::inclusive_scan(begin, end, d_first + bounds[i], op, start[i]);
+    }
+  };
+  detail::for_each_index(pool, chunks, scan);
+  return d_first + size;
+}
+
+template <typename RandomIt, typename OutputIt,
+          typename BinaryOp = std::plus<>,
+          typename = detail::require_random_access<RandomIt>,
+          typename = detail::require_random_access<OutputIt>>
+OutputIt inclusive_scan(RandomIt first, RandomIt last, OutputIt d_first,
+                        BinaryOp op = BinaryOp()) {
+  return parallel::inclusive_scan(thread_pool::default_pool(), first, last,
+                                  d_first, op);
+}
+
+// A merge sort: one chunk per thread is sorted with std::sort, then the
+// sorted runs are merged pairwise, back and forth between the range and a
+// buffer of the same size, each round cut into as many pieces as there
+// are threads. Not stable; the elements must be move-constructible.
+template <typename RandomIt, typename Compare = std::less<>,
+          typename = detail::require_random_access<RandomIt>>
+void sort(thread_pool &pool, RandomIt first, RandomIt last,
+          Compare comp = Compare()) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  size_t size = size_t(last - first);
+  size_t chunks = detail::chunk_count(pool, size, 1);
+  if (chunks == 1) {
+    std::sort(first, last, comp);
+    return;
+  }
+  s21::vector<size_t> bounds = detail::split(size, chunks);
+  auto sort_chunk = [&](size_t i) {
+    std::sort(first + bounds[i], first + bounds[i + 1], comp);
+  };
+  detail::for_each_index(pool, chunks, sort_chunk);
+
+  // The runs move to the buffer first, which leaves the range holding
+  // moved-from elements that the next round can assign to.
+  detail::merge_buffer<T> buffer(size);
+  std::uninitialized_move(first, last, buffer.data());
+  buffer.set_constructed(size);
+  bool in_buffer = true;
+  while (bounds.size() > 2) {
+    size_t runs = bounds.size() - 1;
+    size_t pieces = std::max<size_t>(1, chunks / (runs / 2));
+    if (in_buffer) {
+      detail::merge_round(pool, buffer.data(), first, bounds, pieces, comp);
+    } else {
+      detail::merge_round(pool, first, buffer.data(), bounds, pieces, comp);
+    }
+    in_buffer = !in_buffer;
+    s21::vector<size_t> merged;
+    merged.reserve(runs / 2 + 2);
+    for (size_t i = 0; i < runs; i += 2) merged.push_back(bounds[i]);
+    merged.push_back(size);
+    bounds.swap(merged);
+  }
+  if (in_buffer) {
+    parallel::transform(pool, buffer.data(), buffer.data() + size, first,
+                        [](T &value) -> T && { return std::move(value); });
+  }
+}
+
+template <typename RandomIt, typename Compare = std::less<>,
+          typename = detail::require_random_access<RandomIt>>
+void sort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+  parallel::sort(thread_pool::default_pool(), first, last, comp);
+}
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // S21_CONTAINERSPLUS_S21_PARALLEL_H
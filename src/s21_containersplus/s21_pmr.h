@@ -0,0 +1,213 @@
+#ifndef S21_CONTAINERSPLUS_S21_PMR_H
+#define S21_CONTAINERSPLUS_S21_PMR_H
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+
+#include "../s21_containers/s21_vector.h"
+
+namespace s21 {
+namespace pmr {
+// Interface of a source of raw memory that containers share through
+// polymorphic_allocator.
+class memory_resource {
+ public:
+  virtual ~memory_resource() = default;
+
+  void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+    return do_allocate(bytes, alignment);
+  }
+
+  void deallocate(void *p, size_t bytes,
+                  size_t alignment = alignof(std::max_align_t)) {
+    do_deallocate(p, bytes, alignment);
+  }
+
+  bool is_equal(const memory_resource &other) const noexcept {
+    return do_is_equal(other);
+  }
+
+ private:
+  virtual void *do_allocate(size_t bytes, size_t alignment) = 0;
+  virtual void do_deallocate(void *p, size_t bytes, size_t alignment) = 0;
+  virtual bool do_is_equal(const memory_resource &other) const noexcept = 0;
+};
+
+inline bool operator==(const memory_resource &a, const memory_resource &b) {
+  return &a == &b || a.is_equal(b);
+}
+
+inline bool operator!=(const memory_resource &a, const memory_resource &b) {
+  return !(a == b);
+}
+
+class new_delete_resource_type : public memory_resource {
+ private:
+  void *do_allocate(size_t bytes, size_t alignment) override {
+    return ::operator new(bytes, std::align_val_t(alignment));
+  }
+
+  void do_deallocate(void *p, size_t bytes, size_t alignment) override {
+    ::operator delete(p, bytes, std::align_val_t(alignment));
+  }
+
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+// The resource behind operator new and delete, used when none is given.
+inline memory_resource *new_delete_resource() noexcept {
+  static new_delete_resource_type resource;
+  return &resource;
+}
+
+// An arena: hands out memory by bumping a pointer through blocks taken from
+// the upstream resource, ignores deallocate and gives everything back at
+// once in release() or the destructor. Each new block is twice as large as
+// the previous one.
+class monotonic_buffer_resource : public memory_resource {
+ public:
+  explicit monotonic_buffer_resource(
+      size_t initial_size = 1024,
+      memory_resource *upstream = new_delete_resource())
+      : upstream_(upstream), next_size_(initial_size > 0 ? initial_size : 1) {}
+
+  // Serves allocations from buffer first. The buffer stays owned by the
+  // caller and has to outlive the resource.
+  monotonic_buffer_resource(void *buffer, size_t size,
+                            memory_resource *upstream = new_delete_resource())
+      : upstream_(upstream),
+        initial_buffer_(buffer),
+        initial_size_(size),
+        current_(buffer),
+        space_(size),
+        next_size_(size > 0 ? size * 2 : 1024) {}
+
+  monotonic_buffer_resource(const monotonic_buffer_resource &) = delete;
+  monotonic_buffer_resource &operator=(const monotonic_buffer_resource &) =
+      delete;
+
+  ~monotonic_buffer_resource() override { release(); }
+
+  void release() {
+    while (blocks_ != nullptr) {
+      Block *next = blocks_->next;
+      upstream_->deallocate(blocks_, blocks_->size, alignof(Block));
+      blocks_ = next;
+    }
+    current_ = initial_buffer_;
+    space_ = initial_size_;
+  }
+
+  memory_resource *upstream_resource() const { return upstream_; }
+
+ private:
+  struct alignas(std::max_align_t) Block {
+    Block *next;
+    size_t size;
+  };
+
+  memory_resource *upstream_;
+  void *initial_buffer_ = nullptr;
+  size_t initial_size_ = 0;
+  Block *blocks_ = nullptr;
+  void *current_ = nullptr;
+  size_t space_ = 0;
+  size_t next_size_;
+
+  void *do_allocate(size_t bytes, size_t alignment) override {
+    if (bytes == 0) bytes = 1;
+    void *p = std::align(alignment, bytes, current_, space_);
+    if (p == nullptr) {
+      if (bytes > std::numeric_limits<size_t>::max() - alignment -
+                      sizeof(Block)) {
+        throw std::bad_alloc();
+      }
+      add_block(bytes + alignment);
+      p = std::align(alignment, bytes, current_, space_);
+      if (p == nullptr) throw std::bad_alloc();
+    }
+    current_ = static_cast<char *>(p) + bytes;
+    space_ -= bytes;
+    return p;
+  }
+
+  void do_deallocate(void *, size_t, size_t) override {}
+
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+  void add_block(size_t min_size) {
+    size_t size = (next_size_ > min_size ? next_size_ : min_size);
+    size_t total = sizeof(Block) + size;
+    Block *block =
+        static_cast<Block *>(upstream_->allocate(total, alignof(Block)));
+    block->next = blocks_;
+    block->size = total;
+    blocks_ = block;
+    current_ = block + 1;
+    space_ = size;
+    next_size_ = size * 2;
+  }
+};
+
+// A stateful allocator that forwards to a memory_resource. Containers keep
+// the resource they were built with: it does not move over on copy, move or
+// swap, and copies of a container start on the default resource.
+template <typename T>
+class polymorphic_allocator {
+ public:
+  using value_type = T;
+
+  polymorphic_allocator() noexcept : resource_(new_delete_resource()) {}
+  polymorphic_allocator(memory_resource *resource) noexcept
+      : resource_(resource) {}
+  template <typename U>
+  polymorphic_allocator(const polymorphic_allocator<U> &other) noexcept
+      : resource_(other.resource()) {}
+
+  polymorphic_allocator &operator=(const polymorphic_allocator &) = delete;
+
+  T *allocate(size_t n) {
+    if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(resource_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T *p, size_t n) {
+    resource_->deallocate(p, n * sizeof(T), alignof(T));
+  }
+
+  polymorphic_allocator select_on_container_copy_construction() const {
+    return polymorphic_allocator();
+  }
+
+  memory_resource *resource() const noexcept { return resource_; }
+
+ private:
+  memory_resource *resource_;
+};
+
+template <typename T, typename U>
+inline bool operator==(const polymorphic_allocator<T> &a,
+                       const polymorphic_allocator<U> &b) noexcept {
+  return *a.resource() == *b.resource();
+}
+
+template <typename T, typename U>
+inline bool operator!=(const polymorphic_allocator<T> &a,
+                       const polymorphic_allocator<U> &b) noexcept {
+  return !(a == b);
+}
+
+template <typename T>
+using vector = s21::vector<T, polymorphic_allocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // S21_CONTAINERSPLUS_S21_PMR_H
@@ -0,0 +1,265 @@
+#ifndef S21_CONTAINERSPLUS_S21_RADIX_SORT_H
+#define S21_CONTAINERSPLUS_S21_RADIX_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_containers/s21_vector.h"
+#include "s21_parallel.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+// The key of an element that is its own key.
+struct radix_identity {
+  template <typename T>
+  constexpr T &&operator()(T &&value) const noexcept {
+    return std::forward<T>(value);
+  }
+};
+
+namespace detail {
+template <size_t Size>
+struct radix_unsigned;
+template <>
+struct radix_unsigned<1> {
+  using type = uint8_t;
+};
+template <>
+struct radix_unsigned<2> {
+  using type = uint16_t;
+};
+template <>
+struct radix_unsigned<4> {
+  using type = uint32_t;
+};
+template <>
+struct radix_unsigned<8> {
+  using type = uint64_t;
+};
+
+template <typename RandomIt>
+using radix_value_t = typename std::iterator_traits<RandomIt>::value_type;
+
+template <typename Key, typename T>
+using radix_key_t = std::decay_t<std::invoke_result_t<Key &, const T &>>;
+
+template <typename RandomIt, typename Key>
+using require_radix_key = std::enable_if_t<
+    std::is_invocable_v<Key &, const radix_value_t<RandomIt> &>>;
+
+// 11-bit digits: six passes for 64-bit keys instead of eight, with tables
+// of counts that still fit in L1.
+constexpr unsigned kRadixDigitBits = 11;
+constexpr size_t kRadixBuckets = size_t(1) << kRadixDigitBits;
+constexpr size_t kRadixMask = kRadixBuckets - 1;
+// Shorter ranges are sorted by std::stable_sort on the same order.
+constexpr size_t kRadixCutoff = 256;
+
+// Maps a key to an unsigned integer of its size that sorts the same way:
+// signed integers get their sign bit flipped, negative floating-point
+// numbers all their bits and positive ones the sign bit. -0.0 sorts just
+// before 0.0, and NaNs go to the ends by their sign.
+template <typename Key>
+auto radix_bits(Key key) noexcept {
+  static_assert(std::is_arithmetic_v<Key> && !std::is_same_v<Key, bool>,
+                "radix_sort keys must be integers or floating-point numbers");
+  static_assert(sizeof(Key) <= 8, "radix_sort keys must fit in 64 bits");
+  using Bits = typename radix_unsigned<sizeof(Key)>::type;
+  constexpr Bits kSign = Bits(Bits(1) << (sizeof(Key) * 8 - 1));
+  if constexpr (std::is_floating_point_v<Key>) {
+    Bits bits;
+    std::memcpy(&bits, &key, sizeof(bits));
+    return (bits & kSign) ? Bits(~bits) : Bits(bits | kSign);
+  } else if constexpr (std::is_signed_v<Key>) {
+    return Bits(Bits(key) ^ kSign);
+  } else {
+    return Bits(key);
+  }
+}
+
+// Counts the digits of [begin, end) of from: radix_count fills a table of
+// kRadixBuckets counts for each of the lowest passes digits, and
+// radix_count_digit one table for the digit at shift.
+template <typename From, typename Key>
+void radix_count(From from, size_t begin, size_t end, Key &key,
+                 size_t *counts, unsigned passes) {
+  for (size_t i = begin; i < end; ++i) {
+    auto bits = radix_bits(key(from[i]));
+    for (unsigned pass = 0; pass < passes; ++pass) {
+      ++counts[pass * kRadixBuckets +
+               ((bits >> (pass * kRadixDigitBits)) & kRadixMask)];
+    }
+  }
+}
+
+template <typename From, typename Key>
+void radix_count_digit(From from, size_t begin, size_t end, Key &key,
+                       unsigned shift, size_t *counts) {
+  std::fill(counts, counts + kRadixBuckets, size_t(0));
+  for (size_t i = begin; i < end; ++i) {
+    ++counts[(radix_bits(key(from[i])) >> shift) & kRadixMask];
+  }
+}
+
+// Moves [begin, end) of from to to, each element to the next free slot
+// of its digit's bucket; offsets holds the first slot of every bucket.
+template <typename From, typename To, typename Key>
+void radix_scatter(From from, To to, size_t begin, size_t end, Key &key,
+                   unsigned shift, size_t *offsets) {
+  for (size_t i = begin; i < end; ++i) {
+    size_t digit = (radix_bits(key(from[i])) >> shift) & kRadixMask;
+    to[offsets[digit]++] = std::move(from[i]);
+  }
+}
+
+// An LSD radix sort, a digit per pass, between the range and scratch. One
+// read of the input counts every digit, and passes whose digit is the same
+// for all elements are skipped. With a pool every pass is split into one
+// chunk per thread: each chunk counts its digits, the counts become a
+// starting slot for every chunk in every bucket, and the chunks scatter
+// side by side, which keeps the sort stable.
+template <typename RandomIt, typename T, typename Key>
+void radix_sort(thread_pool *pool, RandomIt first, RandomIt last, T *scratch,
+                Key &key) {
+  using Bits = decltype(radix_bits(std::declval<radix_key_t<Key, T>>()));
+  constexpr unsigned kPasses =
+      (sizeof(Bits) * 8 + kRadixDigitBits - 1) / kRadixDigitBits;
+  size_t size = size_t(last - first);
+  if (size < kRadixCutoff) {
+    std::stable_sort(first, last, [&key](const T &a, const T &b) {
+      return radix_bits(key(a)) < radix_bits(key(b));
+    });
+    return;
+  }
+  size_t chunks = pool ? parallel::detail::chunk_count(*pool, size, 1) : 1;
+  s21::vector<size_t> bounds = parallel::detail::split(size, chunks);
+  // counts[c * kPasses + pass] is the table of chunk c for that pass.
+  s21::vector<size_t> counts(chunks * kPasses * kRadixBuckets);
+  auto count_all = [&](size_t c) {
+    radix_count(first, bounds[c], bounds[c + 1], key,
+                &counts[c * kPasses * kRadixBuckets], kPasses);
+  };
+  if (pool) {
+    parallel::detail::for_each_index(*pool, chunks, count_all);
+  } else {
+    count_all(0);
+  }
+
+  s21::vector<size_t> offsets(chunks * kRadixBuckets);
+  bool in_scratch = false, moved = false;
+  for (unsigned pass = 0; pass < kPasses; ++pass) {
+    unsigned shift = pass * kRadixDigitBits;
+    auto table = [&](size_t c) {
+      return &counts[(c * kPasses + pass) * kRadixBuckets];
+    };
+    size_t largest = 0;
+    for (size_t digit = 0; digit < kRadixBuckets; ++digit) {
+      size_t total = 0;
+      for (size_t c = 0; c < chunks; ++c) total += table(c)[digit];
+      largest = std::max(largest, total);
+    }
+    if (largest == size) continue;
+
+    // The counts of every chunk, not just their sums, change once
+    // elements move between chunks.
+    if (moved && chunks > 1) {
+      auto recount = [&](size_t c) {
+        if (in_scratch) {
+          radix_count_digit(scratch, bounds[c], bounds[c + 1], key, shift,
+                            table(c));
+        } else {
+          radix_count_digit(first, bounds[c], bounds[c + 1], key, shift,
+                            table(c));
+        }
+      };
+      parallel::detail::for_each_index(*pool, chunks, recount);
+    }
+    size_t slot = 0;
+    for (size_t digit = 0; digit < kRadixBuckets; ++digit) {
+      for (size_t c = 0; c < chunks; ++c) {
+        offsets[c * kRadixBuckets + digit] = slot;
+        slot += table(c)[digit];
+      }
+    }
+    auto scatter = [&](size_t c) {
+      size_t *chunk_offsets = &offsets[c * kRadixBuckets];
+      if (in_scratch) {
+        radix_scatter(scratch, first, bounds[c], bounds[c + 1], key, shift,
+                      chunk_offsets);
+      } else {
+        radix_scatter(first, scratch, bounds[c], bounds[c + 1], key, shift,
+                      chunk_offsets);
+      }
+    };
+    if (pool) {
+      parallel::detail::for_each_index(*pool, chunks, scatter);
+    } else {
+      scatter(0);
+    }
+    in_scratch = !in_scratch;
+    moved = true;
+  }
+  if (in_scratch) {
+    auto to_range = [](T &value) -> T && { return std::move(value); };
+    if (pool) {
+      parallel::transform(*pool, scratch, scratch + size, first, to_range);
+    } else {
+      std::move(scratch, scratch + size, first);
+    }
+  }
+}
+
+template <typename T>
+void radix_reserve_scratch(s21::vector<T> &scratch, size_t size) {
+  if (scratch.size() < size) scratch.resize_for_overwrite(size);
+}
+}  // namespace detail
+
+// Stable radix sorts of a random-access range by an integer or
+// floating-point key, key(element), in ascending order. The sort moves
+// the elements through a scratch vector of the same length; pass one to
+// reuse it across calls. It is grown with resize_for_overwrite(), so the
+// elements must be default-constructible, and after the sort holds
+// moved-from ones.
+// The overloads taking a pool count and scatter in parallel.
+template <typename RandomIt, typename Key = radix_identity,
+          typename = detail::require_radix_key<RandomIt, Key>>
+void radix_sort(RandomIt first, RandomIt last,
+                s21::vector<detail::radix_value_t<RandomIt>> &scratch,
+                Key key = Key()) {
+  detail::radix_reserve_scratch(scratch, size_t(last - first));
+  detail::radix_sort(nullptr, first, last, scratch.begin(), key);
+}
+
+template <typename RandomIt, typename Key = radix_identity,
+          typename = detail::require_radix_key<RandomIt, Key>>
+void radix_sort(RandomIt first, RandomIt last, Key key = Key()) {
+  s21::vector<detail::radix_value_t<RandomIt>> scratch;
+  s21::radix_sort(first, last, scratch, key);
+}
+
+template <typename RandomIt, typename Key = radix_identity,
+          typename = detail::require_radix_key<RandomIt, Key>>
+void radix_sort(thread_pool &pool, RandomIt first, RandomIt last,
+                s21::vector<detail::radix_value_t<RandomIt>> &scratch,
+                Key key = Key()) {
+  detail::radix_reserve_scratch(scratch, size_t(last - first));
+  detail::radix_sort(&pool, first, last, scratch.begin(), key);
+}
+
+template <typename RandomIt, typename Key = radix_identity,
+          typename = detail::require_radix_key<RandomIt, Key>>
+void radix_sort(thread_pool &pool, RandomIt first, RandomIt last,
+                Key key = Key()) {
+  s21::vector<detail::radix_value_t<RandomIt>> scratch;
+  s21::radix_sort(pool, first, last, scratch, key);
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERSPLUS_S21_RADIX_SORT_H
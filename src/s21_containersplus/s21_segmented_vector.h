@@ -0,0 +1,463 @@
+#ifndef S21_CONTAINERSPLUS_S21_SEGMENTED_VECTOR_H
+#define S21_CONTAINERSPLUS_S21_SEGMENTED_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_containers/s21_vector.h"
+
+namespace s21 {
+namespace detail {
+// About 4 KB of elements, rounded down to a power of two.
+template <typename T>
+constexpr size_t default_chunk_size() {
+  size_t count = 1;
+  while (count * 2 * sizeof(T) <= 4096) count *= 2;
+  return count;
+}
+}  // namespace detail
+
+template <typename Vector, bool Const>
+class segmented_iterator;
+
+// A vector that grows by adding fixed chunks of ChunkSize elements instead
+// of moving everything into a bigger buffer. Elements never move, so
+// pointers and references to them stay valid until they are erased, and
+// growing never copies them or needs twice the memory. Element i lives in
+// chunk i / ChunkSize, found through a table of chunk pointers, which keeps
+// indexing O(1). Only that table is reallocated as the vector grows.
+template <typename T, size_t ChunkSize = detail::default_chunk_size<T>()>
+class segmented_vector {
+  static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0,
+                "ChunkSize must be a power of two");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = segmented_iterator<segmented_vector, false>;
+  using const_iterator = segmented_iterator<segmented_vector, true>;
+  using size_type = size_t;
+
+  static constexpr size_type kChunkSize = ChunkSize;
+
+  segmented_vector() noexcept = default;
+  explicit segmented_vector(size_type n);
+  segmented_vector(std::initializer_list<value_type> const &items);
+  segmented_vector(const segmented_vector &v);
+  segmented_vector(segmented_vector &&v) noexcept;
+  ~segmented_vector();
+
+  segmented_vector &operator=(const segmented_vector &v);
+  segmented_vector &operator=(segmented_vector &&v) noexcept;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+
+  reference front();
+  const_reference front() const;
+
+  reference back();
+  const_reference back() const;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type capacity() const noexcept;
+  size_type chunk_count() const noexcept;
+  void reserve(size_type new_capacity);
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  void resize(size_type count);
+  void push_back(const_reference value);
+  void push_back(T &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  void swap(segmented_vector &other) noexcept;
+
+ private:
+  static constexpr size_type kShift = [] {
+    size_type shift = 0;
+    while ((size_type(1) << shift) < ChunkSize) ++shift;
+    return shift;
+  }();
+
+  s21::vector<T *> chunks_;
+  size_type size_ = 0;
+
+  void add_chunk();
+  void release() noexcept;
+};
+
+template <typename Vector, bool Const>
+class segmented_iterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = typename Vector::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<Const, const value_type *, value_type *>;
+  using reference =
+      std::conditional_t<Const, const value_type &, value_type &>;
+  using container = std::conditional_t<Const, const Vector, Vector>;
+
+  segmented_iterator() noexcept = default;
+  segmented_iterator(container *vector, size_t index) noexcept
+      : vector_(vector), index_(index) {}
+  template <bool C = Const, typename = std::enable_if_t<C>>
+  segmented_iterator(const segmented_iterator<Vector, false> &other) noexcept
+      : vector_(other.vector_), index_(other.index_) {}
+
+  reference operator*() const { return (*vector_)[index_]; }
+  pointer operator->() const { return &(*vector_)[index_]; }
+  reference operator[](difference_type n) const {
+    return (*vector_)[index_ + n];
+  }
+
+  segmented_iterator &operator++() {
+    ++index_;
+    return *this;
+  }
+
+  segmented_iterator operator++(int) {
+    segmented_iterator temp = *this;
+    ++index_;
+    return temp;
+  }
+
+  segmented_iterator &operator--() {
+    --index_;
+    return *this;
+  }
+
+  segmented_iterator operator--(int) {
+    segmented_iterator temp = *this;
+    --index_;
+    return temp;
+  }
+
+  segmented_iterator &operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+
+  segmented_iterator &operator-=(difference_type n) {
+    index_ -= n;
+    return *this;
+  }
+
+  segmented_iterator operator+(difference_type n) const {
+    return segmented_iterator(vector_, index_ + n);
+  }
+
+  friend segmented_iterator operator+(difference_type n,
+                                      const segmented_iterator &it) {
+    return it + n;
+  }
+
+  segmented_iterator operator-(difference_type n) const {
+    return segmented_iterator(vector_, index_ - n);
+  }
+
+  difference_type operator-(const segmented_iterator &other) const {
+    return static_cast<difference_type>(index_ - other.index_);
+  }
+
+  bool operator==(const segmented_iterator &other) const {
+    return index_ == other.index_ && vector_ == other.vector_;
+  }
+  bool operator!=(const segmented_iterator &other) const {
+    return !(*this == other);
+  }
+  bool operator<(const segmented_iterator &other) const {
+    return index_ < other.index_;
+  }
+  bool operator>(const segmented_iterator &other) const {
+    return other < *this;
+  }
+  bool operator<=(const segmented_iterator &other) const {
+    return !(other < *this);
+  }
+  bool operator>=(const segmented_iterator &other) const {
+    return !(*this < other);
+  }
+
+ private:
+  template <typename, bool>
+  friend class segmented_iterator;
+
+  container *vector_ = nullptr;
+  size_t index_ = 0;
+};
+
+template <typename T, size_t ChunkSize>
+segmented_vector<T, ChunkSize>::segmented_vector(size_type n) {
+  try {
+    resize(n);
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, size_t ChunkSize>
+segmented_vector<T, ChunkSize>::segmented_vector(
+    std::initializer_list<value_type> const &items) {
+  try {
+    reserve(items.size());
+    for (const_reference item : items) push_back(item);
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, size_t ChunkSize>
+segmented_vector<T, ChunkSize>::segmented_vector(const segmented_vector &v) {
+  try {
+    reserve(v.size_);
+    for (size_type i = 0; i < v.size_; ++i) push_back(v[i]);
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, size_t ChunkSize>
+inline segmented_vector<T, ChunkSize>::segmented_vector(
+    segmented_vector &&v) noexcept {
+  swap(v);
+}
+
+template <typename T, size_t ChunkSize>
+inline segmented_vector<T, ChunkSize>::~segmented_vector() {
+  release();
+}
+
+template <typename T, size_t ChunkSize>
+inline segmented_vector<T, ChunkSize> &
+segmented_vector<T, ChunkSize>::operator=(const segmented_vector &v) {
+  if (this != &v) {
+    segmented_vector temp(v);
+    swap(temp);
+  }
+  return *this;
+}
+
+template <typename T, size_t ChunkSize>
+inline segmented_vector<T, ChunkSize> &
+segmented_vector<T, ChunkSize>::operator=(segmented_vector &&v) noexcept {
+  if (this != &v) {
+    segmented_vector temp(std::move(v));
+    swap(temp);
+  }
+  return *this;
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::reference
+segmented_vector<T, ChunkSize>::at(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return (*this)[pos];
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::const_reference
+segmented_vector<T, ChunkSize>::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return (*this)[pos];
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::reference
+segmented_vector<T, ChunkSize>::operator[](size_type pos) {
+  return chunks_[pos >> kShift][pos & (ChunkSize - 1)];
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::const_reference
+segmented_vector<T, ChunkSize>::operator[](size_type pos) const {
+  return chunks_[pos >> kShift][pos & (ChunkSize - 1)];
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::reference
+segmented_vector<T, ChunkSize>::front() {
+  return at(0);
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::const_reference
+segmented_vector<T, ChunkSize>::front() const {
+  return at(0);
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::reference
+segmented_vector<T, ChunkSize>::back() {
+  if (size_ == 0) throw std::out_of_range("Index out of range");
+  return (*this)[size_ - 1];
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::const_reference
+segmented_vector<T, ChunkSize>::back() const {
+  if (size_ == 0) throw std::out_of_range("Index out of range");
+  return (*this)[size_ - 1];
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::iterator
+segmented_vector<T, ChunkSize>::begin() noexcept {
+  return iterator(this, 0);
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::const_iterator
+segmented_vector<T, ChunkSize>::begin() const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::iterator
+segmented_vector<T, ChunkSize>::end() noexcept {
+  return iterator(this, size_);
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::const_iterator
+segmented_vector<T, ChunkSize>::end() const noexcept {
+  return const_iterator(this, size_);
+}
+
+template <typename T, size_t ChunkSize>
+inline bool segmented_vector<T, ChunkSize>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::size_type
+segmented_vector<T, ChunkSize>::size() const noexcept {
+  return size_;
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::size_type
+segmented_vector<T, ChunkSize>::capacity() const noexcept {
+  return chunks_.size() * ChunkSize;
+}
+
+template <typename T, size_t ChunkSize>
+inline typename segmented_vector<T, ChunkSize>::size_type
+segmented_vector<T, ChunkSize>::chunk_count() const noexcept {
+  return chunks_.size();
+}
+
+template <typename T, size_t ChunkSize>
+inline void segmented_vector<T, ChunkSize>::reserve(size_type new_capacity) {
+  while (capacity() < new_capacity) add_chunk();
+}
+
+// Frees the chunks past the last element.
+template <typename T, size_t ChunkSize>
+void segmented_vector<T, ChunkSize>::shrink_to_fit() {
+  size_type used = (size_ + ChunkSize - 1) >> kShift;
+  std::allocator<T> alloc;
+  while (chunks_.size() > used) {
+    alloc.deallocate(chunks_.back(), ChunkSize);
+    chunks_.pop_back();
+  }
+  chunks_.shrink_to_fit();
+}
+
+template <typename T, size_t ChunkSize>
+inline void segmented_vector<T, ChunkSize>::clear() noexcept {
+  if constexpr (std::is_trivially_destructible_v<T>) {
+    size_ = 0;
+  } else {
+    while (size_ > 0) pop_back();
+  }
+}
+
+template <typename T, size_t ChunkSize>
+void segmented_vector<T, ChunkSize>::resize(size_type count) {
+  while (size_ > count) pop_back();
+  reserve(count);
+  while (size_ < count) emplace_back();
+}
+
+template <typename T, size_t ChunkSize>
+inline void segmented_vector<T, ChunkSize>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, size_t ChunkSize>
+inline void segmented_vector<T, ChunkSize>::push_back(T &&value) {
+  emplace_back(std::move(value));
+}
+
+// The elements already stored stay where they are, so args may refer to
+// them even when a chunk is added.
+template <typename T, size_t ChunkSize>
+template <typename... Args>
+inline typename segmented_vector<T, ChunkSize>::reference
+segmented_vector<T, ChunkSize>::emplace_back(Args &&...args) {
+  if (size_ == capacity()) add_chunk();
+  T *slot = &(*this)[size_];
+  ::new (static_cast<void *>(slot)) T(std::forward<Args>(args)...);
+  ++size_;
+  return *slot;
+}
+
+template <typename T, size_t ChunkSize>
+inline void segmented_vector<T, ChunkSize>::pop_back() {
+  if (size_ > 0) {
+    --size_;
+    (*this)[size_].~T();
+  }
+}
+
+template <typename T, size_t ChunkSize>
+inline void segmented_vector<T, ChunkSize>::swap(
+    segmented_vector &other) noexcept {
+  chunks_.swap(other.chunks_);
+  std::swap(size_, other.size_);
+}
+
+// ADDITIONAL FUNCTIONS
+
+template <typename T, size_t ChunkSize>
+void segmented_vector<T, ChunkSize>::add_chunk() {
+  std::allocator<T> alloc;
+  T *chunk = alloc.allocate(ChunkSize);
+  try {
+    chunks_.push_back(chunk);
+  } catch (...) {
+    alloc.deallocate(chunk, ChunkSize);
+    throw;
+  }
+}
+
+template <typename T, size_t ChunkSize>
+void segmented_vector<T, ChunkSize>::release() noexcept {
+  clear();
+  std::allocator<T> alloc;
+  for (T *chunk : chunks_) alloc.deallocate(chunk, ChunkSize);
+  chunks_.clear();
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERSPLUS_S21_SEGMENTED_VECTOR_H
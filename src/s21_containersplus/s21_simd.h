@@ -0,0 +1,431 @@
+#ifndef S21_CONTAINERSPLUS_S21_SIMD_H
+#define S21_CONTAINERSPLUS_S21_SIMD_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace s21 {
+namespace simd {
+// Width of the vector registers the kernels run on. v128 is SSE2 on x86-64
+// and NEON on ARM64, v256 is AVX2 and v512 is AVX-512 (F, BW and DQ).
+enum class level { scalar, v128, v256, v512 };
+
+// The widest level this CPU runs. Compilers without GCC vector extensions
+// only get the scalar loops.
+inline level supported_level() noexcept {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+      __builtin_cpu_supports("avx512dq")) {
+    return level::v512;
+  }
+  if (__builtin_cpu_supports("avx2")) return level::v256;
+  return level::v128;
+#elif defined(__GNUC__)
+  return level::v128;
+#else
+  return level::scalar;
+#endif
+}
+
+namespace detail {
+inline std::atomic<level> &current_level() noexcept {
+  static std::atomic<level> current(supported_level());
+  return current;
+}
+}  // namespace detail
+
+inline level active_level() noexcept {
+  return detail::current_level().load(std::memory_order_relaxed);
+}
+
+// Caps the level the kernels dispatch to, mostly to compare them in tests
+// and benchmarks. Levels above supported_level() are lowered to it.
+inline void set_level(level value) noexcept {
+  level supported = supported_level();
+  detail::current_level().store(value < supported ? value : supported,
+                                std::memory_order_relaxed);
+}
+
+namespace detail {
+template <typename T>
+struct non_deduced {
+  using type = T;
+};
+
+// Element types that fit a vector lane. Everything else, and every type on
+// the scalar level, goes through plain loops.
+template <typename T>
+constexpr bool is_vectorizable =
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+template <typename Container>
+using value_type_t = typename std::remove_reference_t<Container>::value_type;
+
+template <typename T>
+using sum_type =
+    std::conditional_t<std::is_integral_v<T> && !std::is_same_v<T, bool>,
+                       std::make_unsigned<T>, non_deduced<T>>;
+
+#if defined(__GNUC__)
+// One register of Bytes / sizeof(T) lanes. The kernels only keep vectors in
+// locals, never pass them by value, so the same code is compiled for every
+// target the run_v* wrappers below enable.
+template <typename T, size_t Bytes>
+struct lanes {
+  typedef T vec __attribute__((vector_size(Bytes)));
+  using mask = decltype(vec{} == vec{});
+  // The signed integer each lane of mask holds: all ones or all zeros.
+  using mask_lane = std::conditional_t<
+      sizeof(T) == 1, signed char,
+      std::conditional_t<sizeof(T) == 2, short,
+                         std::conditional_t<sizeof(T) == 4, int, long long>>>;
+
+  static constexpr size_t kCount = Bytes / sizeof(T);
+
+  [[gnu::always_inline]] static void load(vec &v, const void *p) {
+    std::memcpy(&v, p, Bytes);
+  }
+
+  [[gnu::always_inline]] static void store(void *p, const vec &v) {
+    std::memcpy(p, &v, Bytes);
+  }
+
+  [[gnu::always_inline]] static void splat(vec &v, T value) {
+    for (size_t i = 0; i < kCount; ++i) v[i] = value;
+  }
+
+  [[gnu::always_inline]] static bool any(const mask &m) {
+    unsigned long long words[Bytes / sizeof(unsigned long long)];
+    std::memcpy(words, &m, Bytes);
+    unsigned long long bits = 0;
+    for (unsigned long long word : words) bits |= word;
+    return bits != 0;
+  }
+};
+#endif
+
+// Each kernel is a run<T, Bytes> that walks whole vectors of Bytes and
+// finishes the tail with the scalar loop; run<T, 0> is the scalar loop
+// alone.
+struct find_kernel {
+  template <typename T, size_t Bytes>
+  [[gnu::always_inline]] static const T *run(const T *first, const T *last,
+                                              const T &value) {
+#if defined(__GNUC__)
+    if constexpr (Bytes > 0) {
+      using L = lanes<T, Bytes>;
+      constexpr size_t kStep = L::kCount * 4;
+      typename L::vec needle, a, b, c, d;
+      L::splat(needle, value);
+      for (; static_cast<size_t>(last - first) >= kStep; first += kStep) {
+        L::load(a, first);
+        L::load(b, first + L::kCount);
+        L::load(c, first + L::kCount * 2);
+        L::load(d, first + L::kCount * 3);
+        // Matching lanes are -1, so the sum of the masks is non-zero where
+        // any of them matched. GCC turns | of AVX-512 masks into scalar
+        // code, but adds them in registers.
+        if (L::any((a == needle) + (b == needle) + (c == needle) +
+                   (d == needle))) {
+          break;
+        }
+      }
+    }
+#endif
+    while (first != last && !(*first == value)) ++first;
+    return first;
+  }
+};
+
+struct count_kernel {
+  template <typename T, size_t Bytes>
+  [[gnu::always_inline]] static size_t run(const T *first, const T *last,
+                                           const T &value) {
+    size_t total = 0;
+#if defined(__GNUC__)
+    if constexpr (Bytes > 0) {
+      using L = lanes<T, Bytes>;
+      // A lane counts at most one match per vector, so it is emptied into
+      // total before it can overflow.
+      constexpr size_t kFlush = static_cast<size_t>(
+          std::numeric_limits<typename L::mask_lane>::max());
+      typename L::vec needle, block;
+      L::splat(needle, value);
+      while (static_cast<size_t>(last - first) >= L::kCount) {
+        size_t blocks = static_cast<size_t>(last - first) / L::kCount;
+        if (blocks > kFlush) blocks = kFlush;
+        typename L::mask matches{};
+        for (size_t i = 0; i < blocks; ++i, first += L::kCount) {
+          L::load(block, first);
+          matches -= (block == needle);
+        }
+        for (size_t i = 0; i < L::kCount; ++i) {
+          total += static_cast<size_t>(matches[i]);
+        }
+      }
+    }
+#endif
+    for (; first != last; ++first) {
+      if (*first == value) ++total;
+    }
+    return total;
+  }
+};
+
+template <bool Max>
+struct extremum_kernel {
+  template <typename T>
+  static bool better(const T &a, const T &b) {
+    return Max ? b < a : a < b;
+  }
+
+  // Finds the extreme value lane by lane, then the first element equal to
+  // it, so the result is the same element std::min_element and
+  // std::max_element pick.
+  template <typename T, size_t Bytes>
+  [[gnu::always_inline]] static const T *run(const T *first, const T *last) {
+    if (first == last) return last;
+    const T *begin = first;
+    T best = *first;
+#if defined(__GNUC__)
+    if constexpr (Bytes > 0) {
+      using L = lanes<T, Bytes>;
+      if (static_cast<size_t>(last - first) >= L::kCount) {
+        typename L::vec acc, block;
+        L::load(acc, first);
+        for (first += L::kCount;
+             static_cast<size_t>(last - first) >= L::kCount;
+             first += L::kCount) {
+          L::load(block, first);
+          if constexpr (Max) {
+            acc = (acc < block ? block : acc);
+          } else {
+            acc = (block < acc ? block : acc);
+          }
+        }
+        best = acc[0];
+        for (size_t i = 1; i < L::kCount; ++i) {
+          if (better<T>(acc[i], best)) best = acc[i];
+        }
+      }
+    }
+#endif
+    for (; first != last; ++first) {
+      if (better(*first, best)) best = *first;
+    }
+    return find_kernel::run<T, Bytes>(begin, last, best);
+  }
+};
+
+struct sum_kernel {
+  // Integers are added as their unsigned type, so overflow wraps instead of
+  // being undefined. Floating point vectors add the lanes in a different
+  // order than a left-to-right loop, so the rounding may differ.
+  template <typename T, size_t Bytes>
+  [[gnu::always_inline]] static T run(const T *first, const T *last) {
+    using U = typename sum_type<T>::type;
+    U total = U();
+#if defined(__GNUC__)
+    if constexpr (Bytes > 0) {
+      using L = lanes<U, Bytes>;
+      typename L::vec acc{}, block;
+      for (; static_cast<size_t>(last - first) >= L::kCount;
+           first += L::kCount) {
+        L::load(block, first);
+        acc += block;
+      }
+      for (size_t i = 0; i < L::kCount; ++i) total += acc[i];
+    }
+#endif
+    for (; first != last; ++first) total += static_cast<U>(*first);
+    return static_cast<T>(total);
+  }
+};
+
+struct fill_kernel {
+  template <typename T, size_t Bytes>
+  [[gnu::always_inline]] static void run(T *first, T *last, const T &value) {
+#if defined(__GNUC__)
+    if constexpr (Bytes > 0) {
+      using L = lanes<T, Bytes>;
+      typename L::vec block;
+      L::splat(block, value);
+      for (; static_cast<size_t>(last - first) >= L::kCount;
+           first += L::kCount) {
+        L::store(first, block);
+      }
+    }
+#endif
+    for (; first != last; ++first) *first = value;
+  }
+};
+
+struct equal_kernel {
+  template <typename T, size_t Bytes>
+  [[gnu::always_inline]] static bool run(const T *first, const T *last,
+                                         const T *other) {
+#if defined(__GNUC__)
+    if constexpr (Bytes > 0) {
+      using L = lanes<T, Bytes>;
+      constexpr size_t kStep = L::kCount * 2;
+      typename L::vec a, b, c, d;
+      for (; static_cast<size_t>(last - first) >= kStep;
+           first += kStep, other += kStep) {
+        L::load(a, first);
+        L::load(b, other);
+        L::load(c, first + L::kCount);
+        L::load(d, other + L::kCount);
+        if (L::any((a != b) + (c != d))) return false;
+      }
+    }
+#endif
+    for (; first != last; ++first, ++other) {
+      if (!(*first == *other)) return false;
+    }
+    return true;
+  }
+};
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+// The kernels are inlined into these, so their vectors are compiled for
+// AVX2 and AVX-512 while the rest of the program keeps the baseline target.
+template <typename Kernel, typename T, typename... Args>
+[[gnu::target("avx2")]] auto run_v256(const Args &...args) {
+  return Kernel::template run<T, 32>(args...);
+}
+
+template <typename Kernel, typename T, typename... Args>
+[[gnu::target("avx512f,avx512bw,avx512dq")]] auto run_v512(
+    const Args &...args) {
+  return Kernel::template run<T, 64>(args...);
+}
+#endif
+
+template <typename Kernel, typename T, typename... Args>
+auto dispatch(const Args &...args) {
+#if defined(__GNUC__)
+  if constexpr (is_vectorizable<T>) {
+    switch (active_level()) {
+#if defined(__x86_64__) || defined(__i386__)
+      case level::v512:
+        return run_v512<Kernel, T>(args...);
+      case level::v256:
+        return run_v256<Kernel, T>(args...);
+#else
+      case level::v512:
+      case level::v256:
+#endif
+      case level::v128:
+        return Kernel::template run<T, 16>(args...);
+      case level::scalar:
+        break;
+    }
+  }
+#endif
+  return Kernel::template run<T, 0>(args...);
+}
+}  // namespace detail
+
+// Vectorized versions of the std algorithms of the same names for
+// arithmetic element types. Other element types use the plain loops, so
+// these work on any contiguous range.
+
+template <typename T>
+inline const T *find(const T *first, const T *last,
+                     const typename detail::non_deduced<T>::type &value) {
+  return detail::dispatch<detail::find_kernel, T>(first, last, value);
+}
+
+template <typename T>
+inline size_t count(const T *first, const T *last,
+                    const typename detail::non_deduced<T>::type &value) {
+  return detail::dispatch<detail::count_kernel, T>(first, last, value);
+}
+
+// The first smallest element, or last for an empty range. The result for a
+// floating point range holding NaN is unspecified.
+template <typename T>
+inline const T *min_element(const T *first, const T *last) {
+  return detail::dispatch<detail::extremum_kernel<false>, T>(first, last);
+}
+
+// The first largest element, or last for an empty range.
+template <typename T>
+inline const T *max_element(const T *first, const T *last) {
+  return detail::dispatch<detail::extremum_kernel<true>, T>(first, last);
+}
+
+// The sum of the range, like std::accumulate(first, last, T()), except that
+// float lanes are added in a different order, so the rounding may differ,
+// and signed integers wrap on overflow where accumulate would be undefined.
+template <typename T>
+inline T sum(const T *first, const T *last) {
+  return detail::dispatch<detail::sum_kernel, T>(first, last);
+}
+
+template <typename T>
+inline void fill(T *first, T *last,
+                 const typename detail::non_deduced<T>::type &value) {
+  detail::dispatch<detail::fill_kernel, T>(first, last, value);
+}
+
+template <typename T>
+inline bool equal(const T *first, const T *last, const T *other) {
+  return detail::dispatch<detail::equal_kernel, T>(first, last, other);
+}
+
+// The same algorithms over the elements of a contiguous container such as
+// s21::vector, s21::array or a soa_vector column. Positions come back as
+// the container's iterators.
+
+template <typename Container>
+inline auto find(Container &&c, const detail::value_type_t<Container> &value) {
+  auto first = c.data();
+  return c.begin() + (find(first, first + c.size(), value) - first);
+}
+
+template <typename Container>
+inline size_t count(Container &&c,
+                    const detail::value_type_t<Container> &value) {
+  auto first = c.data();
+  return count(first, first + c.size(), value);
+}
+
+template <typename Container>
+inline auto min_element(Container &&c) {
+  auto first = c.data();
+  return c.begin() + (min_element(first, first + c.size()) - first);
+}
+
+template <typename Container>
+inline auto max_element(Container &&c) {
+  auto first = c.data();
+  return c.begin() + (max_element(first, first + c.size()) - first);
+}
+
+template <typename Container>
+inline detail::value_type_t<Container> sum(Container &&c) {
+  auto first = c.data();
+  return sum(first, first + c.size());
+}
+
+template <typename Container>
+inline void fill(Container &&c, const detail::value_type_t<Container> &value) {
+  auto first = c.data();
+  fill(first, first + c.size(), value);
+}
+
+template <typename Container, typename Other>
+inline bool equal(Container &&a, Other &&b) {
+  auto first = a.data();
+  return a.size() == b.size() && equal(first, first + a.size(), b.data());
+}
+}  // namespace simd
+}  // namespace s21
+
+#endif  // S21_CONTAINERSPLUS_S21_SIMD_H
@@ -0,0 +1,569 @@
+#ifndef S21_CONTAINERSPLUS_S21_SMALL_VECTOR_H
+#define S21_CONTAINERSPLUS_S21_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// A vector that keeps up to N elements inside the object and moves them to
+// the heap only when it outgrows that buffer. Once on the heap, moving the
+// vector only hands the buffer over.
+template <typename T, size_t N>
+class small_vector {
+  static_assert(N > 0, "small_vector needs room for at least one element");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  template <typename InputIt>
+  using require_input_iterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<InputIt>::iterator_category,
+      std::input_iterator_tag>>;
+
+  small_vector();
+  explicit small_vector(size_type n);
+  small_vector(std::initializer_list<value_type> const &items);
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  small_vector(InputIt first, InputIt last);
+  small_vector(const small_vector &v);
+  small_vector(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  ~small_vector();
+
+  small_vector &operator=(const small_vector &v);
+  small_vector &operator=(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  small_vector &operator=(std::initializer_list<value_type> const &items);
+
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  void assign(InputIt first, InputIt last);
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+
+  reference front();
+  const_reference front() const;
+
+  reference back();
+  const_reference back() const;
+
+  iterator data() noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type new_capacity);
+  size_type capacity() const;
+  void shrink_to_fit();
+  bool is_inline() const noexcept;
+
+  void clear();
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, T &&value);
+  iterator insert(const_iterator pos, size_type count, const T &value);
+  template <typename InputIt, typename = require_input_iterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  template <typename Range>
+  void append_range(Range &&range);
+  iterator erase(iterator pos);
+  void push_back(const_reference value);
+  void push_back(T &&value);
+  void pop_back();
+  void swap(small_vector &other);
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  using allocator_type = std::allocator<T>;
+  using alloc_traits = std::allocator_traits<allocator_type>;
+
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+  iterator data_;
+  size_type size_;
+  size_type capacity_;
+  allocator_type alloc_;
+
+  iterator inline_data() noexcept;
+  size_type grow_capacity(size_type count) const;
+  void relocate(size_type new_capacity);
+  void release();
+  void steal(small_vector &other);
+  template <typename Construct>
+  iterator insert_with(size_type iter_pos, size_type count,
+                       Construct construct);
+};
+
+template <typename T, size_t N>
+inline small_vector<T, N>::small_vector()
+    : data_(inline_data()), size_(0), capacity_(N), alloc_() {}
+
+template <typename T, size_t N>
+inline small_vector<T, N>::small_vector(size_type n) : small_vector() {
+  reserve(n);
+  for (; size_ < n; ++size_) alloc_traits::construct(alloc_, data_ + size_);
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N>::small_vector(
+    std::initializer_list<value_type> const &items)
+    : small_vector(items.begin(), items.end()) {}
+
+template <typename T, size_t N>
+template <typename InputIt, typename>
+inline small_vector<T, N>::small_vector(InputIt first, InputIt last)
+    : small_vector() {
+  insert(end(), first, last);
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N>::small_vector(const small_vector &v)
+    : small_vector(v.begin(), v.end()) {}
+
+template <typename T, size_t N>
+inline small_vector<T, N>::small_vector(small_vector &&v) noexcept(
+    std::is_nothrow_move_constructible_v<T>)
+    : small_vector() {
+  steal(v);
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N>::~small_vector() {
+  release();
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N> &small_vector<T, N>::operator=(
+    const small_vector &v) {
+  if (this != &v) assign(v.begin(), v.end());
+  return *this;
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N> &small_vector<T, N>::operator=(
+    small_vector &&v) noexcept(std::is_nothrow_move_constructible_v<T>) {
+  if (this != &v) {
+    release();
+    data_ = inline_data();
+    capacity_ = N;
+    steal(v);
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N> &small_vector<T, N>::operator=(
+    std::initializer_list<value_type> const &items) {
+  assign(items.begin(), items.end());
+  return *this;
+}
+
+template <typename T, size_t N>
+template <typename InputIt, typename>
+inline void small_vector<T, N>::assign(InputIt first, InputIt last) {
+  clear();
+  insert(end(), first, last);
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::reference small_vector<T, N>::at(
+    size_type pos) {
+  return (pos >= size_ ? throw std::out_of_range("Index out of range")
+                       : data_[pos]);
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::const_reference small_vector<T, N>::at(
+    size_type pos) const {
+  return (pos >= size_ ? throw std::out_of_range("Index out of range")
+                       : data_[pos]);
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::reference small_vector<T, N>::operator[](
+    size_type pos) {
+  return data_[pos];
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::const_reference
+small_vector<T, N>::operator[](size_type pos) const {
+  return data_[pos];
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::reference small_vector<T, N>::front() {
+  return data_[0];
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::const_reference small_vector<T, N>::front()
+    const {
+  return data_[0];
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::reference small_vector<T, N>::back() {
+  return (size_ > 0 ? data_[size_ - 1]
+                    : throw std::out_of_range("Index out of range"));
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::const_reference small_vector<T, N>::back()
+    const {
+  return (size_ > 0 ? data_[size_ - 1]
+                    : throw std::out_of_range("Index out of range"));
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::iterator
+small_vector<T, N>::data() noexcept {
+  return data_;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::iterator
+small_vector<T, N>::begin() noexcept {
+  return data_;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::const_iterator small_vector<T, N>::begin()
+    const noexcept {
+  return data_;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::iterator
+small_vector<T, N>::end() noexcept {
+  return data_ + size_;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::const_iterator small_vector<T, N>::end()
+    const noexcept {
+  return data_ + size_;
+}
+
+template <typename T, size_t N>
+inline bool small_vector<T, N>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::size_type small_vector<T, N>::size() const {
+  return size_;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::size_type small_vector<T, N>::max_size()
+    const {
+  return alloc_traits::max_size(alloc_);
+}
+
+template <typename T, size_t N>
+inline void small_vector<T, N>::reserve(size_type new_capacity) {
+  if (new_capacity > capacity_) relocate(new_capacity);
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::size_type small_vector<T, N>::capacity()
+    const {
+  return capacity_;
+}
+
+// Moves the elements back into the inline buffer when they fit there.
+template <typename T, size_t N>
+inline void small_vector<T, N>::shrink_to_fit() {
+  if (!is_inline() && size_ < capacity_) relocate(size_);
+}
+
+template <typename T, size_t N>
+inline bool small_vector<T, N>::is_inline() const noexcept {
+  return data_ == reinterpret_cast<const T *>(buffer_);
+}
+
+template <typename T, size_t N>
+inline void small_vector<T, N>::clear() {
+  for (size_type i = 0; i < size_; ++i) {
+    alloc_traits::destroy(alloc_, data_ + i);
+  }
+  size_ = 0;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    const_iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    const_iterator pos, T &&value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    const_iterator pos, size_type count, const T &value) {
+  if (pos < begin() || pos > end()) {
+    throw std::out_of_range("Iterator out of range");
+  }
+  value_type copy(value);
+  return insert_with(pos - begin(), count, [&](iterator slot) {
+    alloc_traits::construct(alloc_, slot, copy);
+  });
+}
+
+template <typename T, size_t N>
+template <typename InputIt, typename>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    const_iterator pos, InputIt first, InputIt last) {
+  if (pos < begin() || pos > end()) {
+    throw std::out_of_range("Iterator out of range");
+  }
+  size_type iter_pos = pos - begin();
+  if constexpr (std::is_convertible_v<
+                    typename std::iterator_traits<InputIt>::iterator_category,
+                    std::forward_iterator_tag>) {
+    return insert_with(iter_pos, std::distance(first, last),
+                       [&](iterator slot) {
+                         alloc_traits::construct(alloc_, slot, *first);
+                         ++first;
+                       });
+  } else {
+    size_type old_size = size_;
+    for (; first != last; ++first) emplace_back(*first);
+    std::rotate(begin() + iter_pos, begin() + old_size, end());
+    return begin() + iter_pos;
+  }
+}
+
+template <typename T, size_t N>
+template <typename Range>
+inline void small_vector<T, N>::append_range(Range &&range) {
+  insert(end(), std::begin(range), std::end(range));
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::iterator small_vector<T, N>::erase(
+    iterator pos) {
+  if (pos < begin() || pos >= end()) {
+    throw std::out_of_range("Iterator out of range");
+  }
+  std::move(pos + 1, end(), pos);
+  pop_back();
+  return pos;
+}
+
+template <typename T, size_t N>
+inline void small_vector<T, N>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, size_t N>
+inline void small_vector<T, N>::push_back(T &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, size_t N>
+inline void small_vector<T, N>::pop_back() {
+  if (!empty()) {
+    --size_;
+    alloc_traits::destroy(alloc_, data_ + size_);
+  }
+}
+
+template <typename T, size_t N>
+inline void small_vector<T, N>::swap(small_vector &other) {
+  if (this == &other) return;
+  if (!is_inline() && !other.is_inline()) {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  } else {
+    small_vector temp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(temp);
+  }
+}
+
+// args may refer to an element of this vector, so when the buffer is full
+// the new element is built before the elements are relocated.
+template <typename T, size_t N>
+template <typename... Args>
+inline typename small_vector<T, N>::reference small_vector<T, N>::emplace_back(
+    Args &&...args) {
+  if (size_ < capacity_) {
+    alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+  } else {
+    value_type value(std::forward<Args>(args)...);
+    relocate(grow_capacity(1));
+    alloc_traits::construct(alloc_, data_ + size_, std::move(value));
+  }
+  return data_[size_++];
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+inline typename small_vector<T, N>::iterator small_vector<T, N>::emplace(
+    const_iterator pos, Args &&...args) {
+  if (pos < begin() || pos > end()) {
+    throw std::out_of_range("Iterator out of range");
+  }
+  size_type iter_pos = pos - begin();
+  value_type value(std::forward<Args>(args)...);
+  return insert_with(iter_pos, 1, [&](iterator slot) {
+    alloc_traits::construct(alloc_, slot, std::move(value));
+  });
+}
+
+// Like emplace(), builds the elements before the buffer may be relocated,
+// because args may refer to elements of this vector.
+template <typename T, size_t N>
+template <typename... Args>
+inline typename small_vector<T, N>::iterator small_vector<T, N>::insert_many(
+    const_iterator pos, Args &&...args) {
+  if (pos < begin() || pos > end()) {
+    throw std::out_of_range("Iterator out of range");
+  }
+  size_type iter_pos = pos - begin();
+  if constexpr (sizeof...(Args) == 0) {
+    return begin() + iter_pos;
+  } else {
+    value_type values[] = {value_type(std::forward<Args>(args))...};
+    value_type *next = values;
+    return insert_with(iter_pos, sizeof...(Args), [&](iterator slot) {
+      alloc_traits::construct(alloc_, slot, std::move(*next++));
+    });
+  }
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+inline void small_vector<T, N>::insert_many_back(Args &&...args) {
+  insert_many(end(), std::forward<Args>(args)...);
+}
+
+// ADDITIONAL FUNCTIONS
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::iterator
+small_vector<T, N>::inline_data() noexcept {
+  return reinterpret_cast<iterator>(buffer_);
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::size_type small_vector<T, N>::grow_capacity(
+    size_type count) const {
+  if (max_size() - size_ < count) {
+    throw std::length_error("Vector is too long");
+  }
+  size_type new_capacity = size_ + (size_ > count ? size_ : count);
+  return (new_capacity > max_size() ? max_size() : new_capacity);
+}
+
+// Moves the elements into a heap buffer of new_capacity, or back into the
+// inline buffer when new_capacity fits there.
+template <typename T, size_t N>
+void small_vector<T, N>::relocate(size_type new_capacity) {
+  bool to_inline = new_capacity <= N;
+  if (to_inline && is_inline()) return;
+  iterator new_data = inline_data();
+  if (!to_inline) new_data = alloc_traits::allocate(alloc_, new_capacity);
+  size_type moved = 0;
+  try {
+    for (; moved < size_; ++moved) {
+      alloc_traits::construct(alloc_, new_data + moved,
+                              std::move_if_noexcept(data_[moved]));
+    }
+  } catch (...) {
+    for (size_type i = 0; i < moved; ++i) {
+      alloc_traits::destroy(alloc_, new_data + i);
+    }
+    if (!to_inline) alloc_traits::deallocate(alloc_, new_data, new_capacity);
+    throw;
+  }
+  size_type old_size = size_;
+  release();
+  data_ = new_data;
+  size_ = old_size;
+  capacity_ = (to_inline ? N : new_capacity);
+}
+
+template <typename T, size_t N>
+inline void small_vector<T, N>::release() {
+  clear();
+  if (!is_inline()) alloc_traits::deallocate(alloc_, data_, capacity_);
+}
+
+// Takes a heap buffer over as is and moves inline elements one by one.
+// Expects this vector to be empty and inline.
+template <typename T, size_t N>
+void small_vector<T, N>::steal(small_vector &other) {
+  if (!other.is_inline()) {
+    data_ = other.data_;
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+    other.data_ = other.inline_data();
+    other.size_ = 0;
+    other.capacity_ = N;
+  } else {
+    for (; size_ < other.size_; ++size_) {
+      alloc_traits::construct(alloc_, data_ + size_,
+                              std::move(other.data_[size_]));
+    }
+    other.clear();
+  }
+}
+
+// Appends count elements with construct(slot), which may throw, and
+// rotates them into place at iter_pos. The buffer grows at most once.
+template <typename T, size_t N>
+template <typename Construct>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert_with(
+    size_type iter_pos, size_type count, Construct construct) {
+  if (size_ + count > capacity_) relocate(grow_capacity(count));
+  size_type old_size = size_;
+  try {
+    for (size_type i = 0; i < count; ++i, ++size_) {
+      construct(data_ + size_);
+    }
+  } catch (...) {
+    while (size_ > old_size) pop_back();
+    throw;
+  }
+  std::rotate(begin() + iter_pos, begin() + old_size, end());
+  return begin() + iter_pos;
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERSPLUS_S21_SMALL_VECTOR_H
@@ -0,0 +1,718 @@
+#ifndef S21_CONTAINERSPLUS_S21_SOA_VECTOR_H
+#define S21_CONTAINERSPLUS_S21_SOA_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// A view of one column of a soa_vector: a pointer and a size. It has the
+// data(), size() and begin() of a contiguous container, so s21::simd and
+// the std algorithms run over it directly. Growing the soa_vector
+// invalidates it.
+template <typename T>
+class column_view {
+ public:
+  using value_type = std::remove_cv_t<T>;
+  using reference = T &;
+  using iterator = T *;
+  using size_type = size_t;
+
+  column_view() noexcept = default;
+  column_view(T *data, size_type size) noexcept : data_(data), size_(size) {}
+  template <typename U, typename = std::enable_if_t<
+                            std::is_convertible_v<U (*)[], T (*)[]>>>
+  column_view(const column_view<U> &other) noexcept
+      : data_(other.data()), size_(other.size()) {}
+
+  reference at(size_type pos) const {
+    return (pos >= size_ ? throw std::out_of_range("Index out of range")
+                         : data_[pos]);
+  }
+
+  reference operator[](size_type pos) const { return data_[pos]; }
+
+  T *data() const noexcept { return data_; }
+  iterator begin() const noexcept { return data_; }
+  iterator end() const noexcept { return data_ + size_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+
+ private:
+  T *data_ = nullptr;
+  size_type size_ = 0;
+};
+
+// A reference to one record of a soa_vector, spread over its columns. get<I>
+// and structured bindings give the fields; converting it gives the record as
+// a tuple. Assigning to a row writes the fields, it does not rebind the row.
+template <bool Const, typename... Fields>
+class soa_row {
+ public:
+  using value_type = std::tuple<Fields...>;
+  template <size_t I>
+  using field_reference =
+      std::conditional_t<Const, const std::tuple_element_t<I, value_type> &,
+                         std::tuple_element_t<I, value_type> &>;
+
+  soa_row(const std::tuple<Fields *...> *columns, size_t index) noexcept
+      : columns_(columns), index_(index) {}
+  soa_row(const soa_row &other) noexcept = default;
+  template <bool C = Const, typename = std::enable_if_t<C>>
+  soa_row(const soa_row<false, Fields...> &other) noexcept
+      : columns_(other.columns_), index_(other.index_) {}
+
+  soa_row &operator=(const soa_row &other) {
+    return *this = static_cast<value_type>(other);
+  }
+
+  soa_row &operator=(const value_type &record) {
+    store(record, std::index_sequence_for<Fields...>());
+    return *this;
+  }
+
+  template <size_t I>
+  field_reference<I> get() const {
+    return std::get<I>(*columns_)[index_];
+  }
+
+  operator value_type() const {
+    return load(std::index_sequence_for<Fields...>());
+  }
+
+ private:
+  template <bool, typename...>
+  friend class soa_row;
+
+  const std::tuple<Fields *...> *columns_;
+  size_t index_;
+
+  template <size_t... I>
+  value_type load(std::index_sequence<I...>) const {
+    return value_type(get<I>()...);
+  }
+
+  template <size_t... I>
+  void store(const value_type &record, std::index_sequence<I...>) const {
+    ((get<I>() = std::get<I>(record)), ...);
+  }
+};
+
+template <bool Const, typename... Fields>
+class soa_iterator {
+ public:
+  using iterator_category = std::input_iterator_tag;
+  using value_type = std::tuple<Fields...>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = soa_row<Const, Fields...>;
+
+  soa_iterator(const std::tuple<Fields *...> *columns, size_t index) noexcept
+      : columns_(columns), index_(index) {}
+  template <bool C = Const, typename = std::enable_if_t<C>>
+  soa_iterator(const soa_iterator<false, Fields...> &other) noexcept
+      : columns_(other.columns_), index_(other.index_) {}
+
+  reference operator*() const { return reference(columns_, index_); }
+
+  soa_iterator &operator++() {
+    ++index_;
+    return *this;
+  }
+
+  soa_iterator operator++(int) {
+    soa_iterator temp = *this;
+    ++index_;
+    return temp;
+  }
+
+  difference_type operator-(const soa_iterator &other) const {
+    return static_cast<difference_type>(index_ - other.index_);
+  }
+
+  bool operator==(const soa_iterator &other) const {
+    return index_ == other.index_ && columns_ == other.columns_;
+  }
+
+  bool operator!=(const soa_iterator &other) const {
+    return !(*this == other);
+  }
+
+ private:
+  template <bool, typename...>
+  friend class soa_iterator;
+
+  const std::tuple<Fields *...> *columns_;
+  size_t index_;
+};
+
+// A vector of records stored as a structure of arrays: each field has its
+// own contiguous column, so a scan over one field reads only that field's
+// bytes. Records go in whole through push_back and emplace_back and come
+// out as soa_row proxies; column<I>() exposes field I as a column_view for
+// bulk work. All columns share one allocation and each starts on a cache
+// line.
+template <typename... Fields>
+class soa_vector {
+  static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+
+ public:
+  using value_type = std::tuple<Fields...>;
+  using reference = soa_row<false, Fields...>;
+  using const_reference = soa_row<true, Fields...>;
+  using iterator = soa_iterator<false, Fields...>;
+  using const_iterator = soa_iterator<true, Fields...>;
+  using size_type = size_t;
+
+  template <size_t I>
+  using field_type = std::tuple_element_t<I, value_type>;
+
+  static constexpr size_t kColumnAlignment = 64;
+
+  soa_vector() noexcept = default;
+  explicit soa_vector(size_type n);
+  soa_vector(std::initializer_list<value_type> const &items);
+  soa_vector(const soa_vector &v);
+  soa_vector(soa_vector &&v) noexcept;
+  ~soa_vector();
+
+  soa_vector &operator=(const soa_vector &v);
+  soa_vector &operator=(soa_vector &&v) noexcept;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+
+  reference front();
+  const_reference front() const;
+
+  reference back();
+  const_reference back() const;
+
+  template <size_t I>
+  column_view<field_type<I>> column() noexcept;
+  template <size_t I>
+  column_view<const field_type<I>> column() const noexcept;
+
+  template <size_t I>
+  field_type<I> *data() noexcept;
+  template <size_t I>
+  const field_type<I> *data() const noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  size_type capacity() const noexcept;
+  void reserve(size_type new_capacity);
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  void resize(size_type count);
+  void push_back(const value_type &record);
+  void push_back(value_type &&record);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  void swap(soa_vector &other) noexcept;
+
+ private:
+  using columns_type = std::tuple<Fields *...>;
+
+  // Columns are moved when no field can throw doing it, and copied
+  // otherwise, so a failed reallocation leaves the vector as it was.
+  static constexpr bool kMoveColumns =
+      (std::is_nothrow_move_constructible_v<Fields> && ...) ||
+      !(std::is_copy_constructible_v<Fields> && ...);
+
+  columns_type columns_{};
+  size_type size_ = 0;
+  size_type capacity_ = 0;
+
+  size_type grow_capacity() const;
+  template <typename Record>
+  void append(Record &&record);
+  void reallocate(size_type new_capacity);
+
+  static size_type column_bytes(size_t element_size, size_type capacity);
+  static size_type block_bytes(size_type capacity);
+  static columns_type allocate_columns(size_type capacity);
+  static void deallocate_columns(const columns_type &columns,
+                                 size_type capacity);
+  template <size_t... I>
+  static columns_type make_columns(char *block, const size_t *offsets,
+                                   std::index_sequence<I...>);
+
+  template <size_t I = 0, typename Record>
+  static void construct_row(const columns_type &columns, size_type pos,
+                            Record &&record);
+  template <size_t I = 0>
+  static void construct_rows(const columns_type &columns, size_type first,
+                             size_type last);
+  template <bool Move, size_t I = 0>
+  static void transfer_rows(const columns_type &from, const columns_type &to,
+                            size_type count);
+  template <size_t I = 0>
+  static void destroy_rows(const columns_type &columns, size_type first,
+                           size_type last) noexcept;
+};
+
+// Both delegate to the default constructor, so the destructor frees the
+// columns when a field constructor throws.
+template <typename... Fields>
+inline soa_vector<Fields...>::soa_vector(size_type n) : soa_vector() {
+  resize(n);
+}
+
+template <typename... Fields>
+inline soa_vector<Fields...>::soa_vector(
+    std::initializer_list<value_type> const &items)
+    : soa_vector() {
+  reserve(items.size());
+  for (const value_type &item : items) append(item);
+}
+
+template <typename... Fields>
+soa_vector<Fields...>::soa_vector(const soa_vector &v) {
+  if (v.size_ == 0) return;
+  columns_type columns = allocate_columns(v.size_);
+  try {
+    transfer_rows<false>(v.columns_, columns, v.size_);
+  } catch (...) {
+    deallocate_columns(columns, v.size_);
+    throw;
+  }
+  columns_ = columns;
+  size_ = v.size_;
+  capacity_ = v.size_;
+}
+
+template <typename... Fields>
+inline soa_vector<Fields...>::soa_vector(soa_vector &&v) noexcept {
+  swap(v);
+}
+
+template <typename... Fields>
+inline soa_vector<Fields...>::~soa_vector() {
+  destroy_rows(columns_, 0, size_);
+  deallocate_columns(columns_, capacity_);
+}
+
+template <typename... Fields>
+inline soa_vector<Fields...> &soa_vector<Fields...>::operator=(
+    const soa_vector &v) {
+  if (this != &v) {
+    soa_vector temp(v);
+    swap(temp);
+  }
+  return *this;
+}
+
+template <typename... Fields>
+inline soa_vector<Fields...> &soa_vector<Fields...>::operator=(
+    soa_vector &&v) noexcept {
+  if (this != &v) {
+    soa_vector temp(std::move(v));
+    swap(temp);
+  }
+  return *this;
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::reference soa_vector<Fields...>::at(
+    size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return reference(&columns_, pos);
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::const_reference
+soa_vector<Fields...>::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return const_reference(&columns_, pos);
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::reference
+soa_vector<Fields...>::operator[](size_type pos) {
+  return reference(&columns_, pos);
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::const_reference
+soa_vector<Fields...>::operator[](size_type pos) const {
+  return const_reference(&columns_, pos);
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::reference
+soa_vector<Fields...>::front() {
+  return at(0);
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::const_reference
+soa_vector<Fields...>::front() const {
+  return at(0);
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::reference soa_vector<Fields...>::back() {
+  if (size_ == 0) throw std::out_of_range("Index out of range");
+  return reference(&columns_, size_ - 1);
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::const_reference
+soa_vector<Fields...>::back() const {
+  if (size_ == 0) throw std::out_of_range("Index out of range");
+  return const_reference(&columns_, size_ - 1);
+}
+
+template <typename... Fields>
+template <size_t I>
+inline column_view<typename soa_vector<Fields...>::template field_type<I>>
+soa_vector<Fields...>::column() noexcept {
+  return column_view<field_type<I>>(std::get<I>(columns_), size_);
+}
+
+template <typename... Fields>
+template <size_t I>
+inline column_view<
+    const typename soa_vector<Fields...>::template field_type<I>>
+soa_vector<Fields...>::column() const noexcept {
+  return column_view<const field_type<I>>(std::get<I>(columns_), size_);
+}
+
+template <typename... Fields>
+template <size_t I>
+inline typename soa_vector<Fields...>::template field_type<I> *
+soa_vector<Fields...>::data() noexcept {
+  return std::get<I>(columns_);
+}
+
+template <typename... Fields>
+template <size_t I>
+inline const typename soa_vector<Fields...>::template field_type<I> *
+soa_vector<Fields...>::data() const noexcept {
+  return std::get<I>(columns_);
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::iterator
+soa_vector<Fields...>::begin() noexcept {
+  return iterator(&columns_, 0);
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::const_iterator
+soa_vector<Fields...>::begin() const noexcept {
+  return const_iterator(&columns_, 0);
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::iterator
+soa_vector<Fields...>::end() noexcept {
+  return iterator(&columns_, size_);
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::const_iterator
+soa_vector<Fields...>::end() const noexcept {
+  return const_iterator(&columns_, size_);
+}
+
+template <typename... Fields>
+inline bool soa_vector<Fields...>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::size_type soa_vector<Fields...>::size()
+    const noexcept {
+  return size_;
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::size_type
+soa_vector<Fields...>::max_size() const noexcept {
+  return (std::numeric_limits<size_type>::max() -
+          kColumnAlignment * sizeof...(Fields)) /
+         (sizeof(Fields) + ...);
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::size_type
+soa_vector<Fields...>::capacity() const noexcept {
+  return capacity_;
+}
+
+template <typename... Fields>
+inline void soa_vector<Fields...>::reserve(size_type new_capacity) {
+  if (new_capacity > max_size()) {
+    throw std::length_error("Capacity exceeds max_size");
+  }
+  if (new_capacity > capacity_) reallocate(new_capacity);
+}
+
+template <typename... Fields>
+inline void soa_vector<Fields...>::shrink_to_fit() {
+  if (size_ < capacity_) reallocate(size_);
+}
+
+template <typename... Fields>
+inline void soa_vector<Fields...>::clear() noexcept {
+  destroy_rows(columns_, 0, size_);
+  size_ = 0;
+}
+
+// New records are value-initialised field by field.
+template <typename... Fields>
+void soa_vector<Fields...>::resize(size_type count) {
+  if (count < size_) {
+    destroy_rows(columns_, count, size_);
+  } else if (count > size_) {
+    reserve(count);
+    construct_rows(columns_, size_, count);
+  }
+  size_ = count;
+}
+
+template <typename... Fields>
+inline void soa_vector<Fields...>::push_back(const value_type &record) {
+  append(record);
+}
+
+template <typename... Fields>
+inline void soa_vector<Fields...>::push_back(value_type &&record) {
+  append(std::move(record));
+}
+
+// Builds the fields of the new record from one argument each.
+template <typename... Fields>
+template <typename... Args>
+inline typename soa_vector<Fields...>::reference
+soa_vector<Fields...>::emplace_back(Args &&...args) {
+  static_assert(sizeof...(Args) == sizeof...(Fields),
+                "emplace_back takes one argument per field");
+  append(std::forward_as_tuple(std::forward<Args>(args)...));
+  return reference(&columns_, size_ - 1);
+}
+
+template <typename... Fields>
+inline void soa_vector<Fields...>::pop_back() {
+  if (size_ > 0) {
+    destroy_rows(columns_, size_ - 1, size_);
+    --size_;
+  }
+}
+
+template <typename... Fields>
+inline void soa_vector<Fields...>::swap(soa_vector &other) noexcept {
+  std::swap(columns_, other.columns_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+}
+
+// ADDITIONAL FUNCTIONS
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::size_type
+soa_vector<Fields...>::grow_capacity() const {
+  if (size_ + 1 > max_size()) {
+    throw std::length_error("Capacity exceeds max_size");
+  }
+  size_type doubled = (capacity_ > max_size() / 2 ? max_size() : capacity_ * 2);
+  return (doubled > size_ + 1 ? doubled : size_ + 1);
+}
+
+// When the columns are full, the record is built in the new block before
+// the old records move over, so it may refer to them.
+template <typename... Fields>
+template <typename Record>
+void soa_vector<Fields...>::append(Record &&record) {
+  if (size_ < capacity_) {
+    construct_row(columns_, size_, std::forward<Record>(record));
+  } else {
+    size_type new_capacity = grow_capacity();
+    columns_type columns = allocate_columns(new_capacity);
+    try {
+      construct_row(columns, size_, std::forward<Record>(record));
+    } catch (...) {
+      deallocate_columns(columns, new_capacity);
+      throw;
+    }
+    try {
+      transfer_rows<kMoveColumns>(columns_, columns, size_);
+    } catch (...) {
+      destroy_rows(columns, size_, size_ + 1);
+      deallocate_columns(columns, new_capacity);
+      throw;
+    }
+    destroy_rows(columns_, 0, size_);
+    deallocate_columns(columns_, capacity_);
+    columns_ = columns;
+    capacity_ = new_capacity;
+  }
+  ++size_;
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::reallocate(size_type new_capacity) {
+  columns_type columns = allocate_columns(new_capacity);
+  try {
+    transfer_rows<kMoveColumns>(columns_, columns, size_);
+  } catch (...) {
+    deallocate_columns(columns, new_capacity);
+    throw;
+  }
+  destroy_rows(columns_, 0, size_);
+  deallocate_columns(columns_, capacity_);
+  columns_ = columns;
+  capacity_ = new_capacity;
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::size_type
+soa_vector<Fields...>::column_bytes(size_t element_size, size_type capacity) {
+  return (element_size * capacity + kColumnAlignment - 1) / kColumnAlignment *
+         kColumnAlignment;
+}
+
+template <typename... Fields>
+inline typename soa_vector<Fields...>::size_type
+soa_vector<Fields...>::block_bytes(size_type capacity) {
+  return (column_bytes(sizeof(Fields), capacity) + ...);
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::columns_type
+soa_vector<Fields...>::allocate_columns(size_type capacity) {
+  if (capacity == 0) return columns_type();
+  const size_t sizes[] = {sizeof(Fields)...};
+  size_t offsets[sizeof...(Fields)];
+  size_t total = 0;
+  for (size_t i = 0; i < sizeof...(Fields); ++i) {
+    offsets[i] = total;
+    total += column_bytes(sizes[i], capacity);
+  }
+  char *block = static_cast<char *>(
+      ::operator new(total, std::align_val_t(kColumnAlignment)));
+  return make_columns(block, offsets, std::index_sequence_for<Fields...>());
+}
+
+// The first column starts the block.
+template <typename... Fields>
+inline void soa_vector<Fields...>::deallocate_columns(
+    const columns_type &columns, size_type capacity) {
+  if (capacity > 0) {
+    ::operator delete(std::get<0>(columns), block_bytes(capacity),
+                      std::align_val_t(kColumnAlignment));
+  }
+}
+
+template <typename... Fields>
+template <size_t... I>
+inline typename soa_vector<Fields...>::columns_type
+soa_vector<Fields...>::make_columns(char *block, const size_t *offsets,
+                                    std::index_sequence<I...>) {
+  return columns_type(reinterpret_cast<Fields *>(block + offsets[I])...);
+}
+
+template <typename... Fields>
+template <size_t I, typename Record>
+void soa_vector<Fields...>::construct_row(const columns_type &columns,
+                                          size_type pos, Record &&record) {
+  if constexpr (I < sizeof...(Fields)) {
+    field_type<I> *field = std::get<I>(columns) + pos;
+    ::new (static_cast<void *>(field))
+        field_type<I>(std::get<I>(std::forward<Record>(record)));
+    try {
+      construct_row<I + 1>(columns, pos, std::forward<Record>(record));
+    } catch (...) {
+      field->~field_type<I>();
+      throw;
+    }
+  }
+}
+
+template <typename... Fields>
+template <size_t I>
+void soa_vector<Fields...>::construct_rows(const columns_type &columns,
+                                           size_type first, size_type last) {
+  if constexpr (I < sizeof...(Fields)) {
+    field_type<I> *column = std::get<I>(columns);
+    std::uninitialized_value_construct(column + first, column + last);
+    try {
+      construct_rows<I + 1>(columns, first, last);
+    } catch (...) {
+      std::destroy(column + first, column + last);
+      throw;
+    }
+  }
+}
+
+// Copies or moves the first count records into uninitialised columns.
+template <typename... Fields>
+template <bool Move, size_t I>
+void soa_vector<Fields...>::transfer_rows(const columns_type &from,
+                                          const columns_type &to,
+                                          size_type count) {
+  if constexpr (I < sizeof...(Fields)) {
+    field_type<I> *source = std::get<I>(from);
+    field_type<I> *target = std::get<I>(to);
+    if constexpr (Move) {
+      std::uninitialized_move(source, source + count, target);
+    } else {
+      std::uninitialized_copy(source, source + count, target);
+    }
+    try {
+      transfer_rows<Move, I + 1>(from, to, count);
+    } catch (...) {
+      std::destroy(target, target + count);
+      throw;
+    }
+  }
+}
+
+template <typename... Fields>
+template <size_t I>
+void soa_vector<Fields...>::destroy_rows(const columns_type &columns,
+                                         size_type first,
+                                         size_type last) noexcept {
+  if constexpr (I < sizeof...(Fields)) {
+    if constexpr (!std::is_trivially_destructible_v<field_type<I>>) {
+      std::destroy(std::get<I>(columns) + first, std::get<I>(columns) + last);
+    }
+    destroy_rows<I + 1>(columns, first, last);
+  }
+}
+}  // namespace s21
+
+namespace std {
+template <bool Const, typename... Fields>
+struct tuple_size<s21::soa_row<Const, Fields...>>
+    : std::integral_constant<size_t, sizeof...(Fields)> {};
+
+template <size_t I, bool Const, typename... Fields>
+struct tuple_element<I, s21::soa_row<Const, Fields...>> {
+  using type =
+      typename s21::soa_row<Const, Fields...>::template field_reference<I>;
+};
+}  // namespace std
+
+#endif  // S21_CONTAINERSPLUS_S21_SOA_VECTOR_H
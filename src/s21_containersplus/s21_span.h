@@ -0,0 +1,516 @@
+#ifndef S21_CONTAINERSPLUS_S21_SPAN_H
+#define S21_CONTAINERSPLUS_S21_SPAN_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+constexpr size_t dynamic_extent = size_t(-1);
+
+template <typename T>
+class span;
+template <typename T>
+class strided_view;
+template <typename T>
+class chunk_view;
+
+namespace detail {
+// The first element of a contiguous container: its begin() where that is a
+// pointer, as for s21::vector, s21::array and small_vector, else data().
+template <typename Container>
+auto contiguous_data(Container &c) noexcept {
+  if constexpr (std::is_pointer_v<decltype(c.begin())>) {
+    return c.begin();
+  } else {
+    return c.data();
+  }
+}
+
+template <typename Container>
+using contiguous_pointer_t =
+    decltype(contiguous_data(std::declval<Container &>()));
+
+template <typename Container, typename T, typename = void>
+struct is_span_source : std::false_type {};
+template <typename Container, typename T>
+struct is_span_source<
+    Container, T,
+    std::void_t<contiguous_pointer_t<Container>,
+                decltype(std::declval<Container &>().size())>>
+    : std::bool_constant<
+          !std::is_base_of_v<span<std::remove_const_t<T>>,
+                             std::remove_cv_t<Container>> &&
+          !std::is_base_of_v<span<const T>, std::remove_cv_t<Container>> &&
+          std::is_convertible_v<contiguous_pointer_t<Container>, T *>> {};
+}  // namespace detail
+
+// A view of a contiguous run of elements owned by someone else: a pointer
+// and a length. It is built from a pointer and a size, from two pointers or
+// from an lvalue s21::vector, s21::array or small_vector, and slicing it
+// with subspan(), first() or last() copies nothing. A span<T> converts to a
+// span<const T>, which only gives const access. Its data(), size() and
+// pointer iterators let s21::simd, s21::parallel and the std algorithms run
+// over it directly. Growing the container it views invalidates it.
+template <typename T>
+class span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using reference = T &;
+  using pointer = T *;
+  using iterator = T *;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using size_type = size_t;
+  using difference_type = ptrdiff_t;
+
+  constexpr span() noexcept = default;
+  constexpr span(T *data, size_type size) noexcept
+      : data_(data), size_(size) {}
+  constexpr span(T *first, T *last) noexcept
+      : data_(first), size_(size_type(last - first)) {}
+  template <typename Container,
+            typename = std::enable_if_t<
+                detail::is_span_source<Container, T>::value>>
+  constexpr span(Container &c) noexcept
+      : data_(detail::contiguous_data(c)), size_(c.size()) {}
+  template <typename U, typename = std::enable_if_t<
+                            std::is_convertible_v<U (*)[], T (*)[]>>>
+  constexpr span(const span<U> &other) noexcept
+      : data_(other.data()), size_(other.size()) {}
+
+  constexpr reference at(size_type pos) const;
+  constexpr reference operator[](size_type pos) const { return data_[pos]; }
+  constexpr reference front() const { return at(0); }
+  constexpr reference back() const;
+
+  constexpr T *data() const noexcept { return data_; }
+  constexpr iterator begin() const noexcept { return data_; }
+  constexpr iterator end() const noexcept { return data_ + size_; }
+  constexpr reverse_iterator rbegin() const noexcept {
+    return reverse_iterator(end());
+  }
+  constexpr reverse_iterator rend() const noexcept {
+    return reverse_iterator(begin());
+  }
+
+  constexpr bool empty() const noexcept { return size_ == 0; }
+  constexpr size_type size() const noexcept { return size_; }
+  constexpr size_type size_bytes() const noexcept {
+    return size_ * sizeof(T);
+  }
+
+  constexpr span first(size_type count) const;
+  constexpr span last(size_type count) const;
+  constexpr span subspan(size_type offset,
+                         size_type count = dynamic_extent) const;
+
+  constexpr strided_view<T> strided(size_type stride) const;
+  constexpr chunk_view<T> chunks(size_type chunk_size) const;
+
+ private:
+  T *data_ = nullptr;
+  size_type size_ = 0;
+};
+
+template <typename Container>
+span(Container &)
+    -> span<std::remove_pointer_t<detail::contiguous_pointer_t<Container>>>;
+
+template <typename T>
+constexpr typename span<T>::reference span<T>::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return data_[pos];
+}
+
+template <typename T>
+constexpr typename span<T>::reference span<T>::back() const {
+  if (size_ == 0) throw std::out_of_range("Index out of range");
+  return data_[size_ - 1];
+}
+
+template <typename T>
+constexpr span<T> span<T>::first(size_type count) const {
+  return subspan(0, count);
+}
+
+template <typename T>
+constexpr span<T> span<T>::last(size_type count) const {
+  if (count > size_) throw std::out_of_range("Index out of range");
+  return span(data_ + (size_ - count), count);
+}
+
+// count == dynamic_extent takes everything from offset on.
+template <typename T>
+constexpr span<T> span<T>::subspan(size_type offset, size_type count) const {
+  if (offset > size_) throw std::out_of_range("Index out of range");
+  if (count == dynamic_extent) count = size_ - offset;
+  if (count > size_ - offset) throw std::out_of_range("Index out of range");
+  return span(data_ + offset, count);
+}
+
+template <typename T>
+constexpr strided_view<T> span<T>::strided(size_type stride) const {
+  return strided_view<T>(*this, stride);
+}
+
+template <typename T>
+constexpr chunk_view<T> span<T>::chunks(size_type chunk_size) const {
+  return chunk_view<T>(*this, chunk_size);
+}
+
+// A random-access iterator over every stride-th element from base. It
+// keeps an index rather than a pointer, so the end of a view never points
+// past the storage it views.
+template <typename T>
+class strided_iterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_cv_t<T>;
+  using difference_type = ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  constexpr strided_iterator() noexcept = default;
+  constexpr strided_iterator(T *base, size_t stride, size_t index) noexcept
+      : base_(base), stride_(stride), index_(index) {}
+  template <typename U, typename = std::enable_if_t<
+                            std::is_convertible_v<U (*)[], T (*)[]>>>
+  constexpr strided_iterator(const strided_iterator<U> &other) noexcept
+      : base_(other.base()), stride_(other.stride()), index_(other.index()) {}
+
+  constexpr reference operator*() const { return base_[index_ * stride_]; }
+  constexpr pointer operator->() const { return &**this; }
+  constexpr reference operator[](difference_type n) const {
+    return base_[(index_ + n) * stride_];
+  }
+
+  constexpr strided_iterator &operator++() noexcept {
+    ++index_;
+    return *this;
+  }
+  constexpr strided_iterator operator++(int) noexcept {
+    strided_iterator old = *this;
+    ++index_;
+    return old;
+  }
+  constexpr strided_iterator &operator--() noexcept {
+    --index_;
+    return *this;
+  }
+  constexpr strided_iterator operator--(int) noexcept {
+    strided_iterator old = *this;
+    --index_;
+    return old;
+  }
+  constexpr strided_iterator &operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+  }
+  constexpr strided_iterator &operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+  }
+  constexpr strided_iterator operator+(difference_type n) const noexcept {
+    return strided_iterator(base_, stride_, index_ + n);
+  }
+  friend constexpr strided_iterator operator+(
+      difference_type n, const strided_iterator &it) noexcept {
+    return it + n;
+  }
+  constexpr strided_iterator operator-(difference_type n) const noexcept {
+    return strided_iterator(base_, stride_, index_ - n);
+  }
+  constexpr difference_type operator-(
+      const strided_iterator &other) const noexcept {
+    return difference_type(index_) - difference_type(other.index_);
+  }
+
+  constexpr bool operator==(const strided_iterator &other) const noexcept {
+    return index_ == other.index_;
+  }
+  constexpr bool operator!=(const strided_iterator &other) const noexcept {
+    return index_ != other.index_;
+  }
+  constexpr bool operator<(const strided_iterator &other) const noexcept {
+    return index_ < other.index_;
+  }
+  constexpr bool operator>(const strided_iterator &other) const noexcept {
+    return index_ > other.index_;
+  }
+  constexpr bool operator<=(const strided_iterator &other) const noexcept {
+    return index_ <= other.index_;
+  }
+  constexpr bool operator>=(const strided_iterator &other) const noexcept {
+    return index_ >= other.index_;
+  }
+
+  constexpr T *base() const noexcept { return base_; }
+  constexpr size_t stride() const noexcept { return stride_; }
+  constexpr size_t index() const noexcept { return index_; }
+
+ private:
+  T *base_ = nullptr;
+  size_t stride_ = 1;
+  size_t index_ = 0;
+};
+
+// Every stride-th element of a span, starting with its first: one column
+// of a row-major matrix, or one channel of interleaved samples. A stride of
+// zero throws std::invalid_argument. first(), last() and subview() slice it
+// by position in the view, as the span ones do, and keep the stride.
+template <typename T>
+class strided_view {
+ public:
+  using value_type = std::remove_cv_t<T>;
+  using reference = T &;
+  using iterator = strided_iterator<T>;
+  using size_type = size_t;
+
+  constexpr strided_view() noexcept = default;
+  constexpr strided_view(span<T> elements, size_type stride);
+  template <typename U, typename = std::enable_if_t<
+                            std::is_convertible_v<U (*)[], T (*)[]>>>
+  constexpr strided_view(const strided_view<U> &other) noexcept
+      : data_(other.begin().base()),
+        stride_(other.stride()),
+        size_(other.size()) {}
+
+  constexpr reference at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Index out of range");
+    return data_[pos * stride_];
+  }
+  constexpr reference operator[](size_type pos) const {
+    return data_[pos * stride_];
+  }
+  constexpr reference front() const { return at(0); }
+  constexpr reference back() const { return at(size_ - 1); }
+
+  constexpr iterator begin() const noexcept {
+    return iterator(data_, stride_, 0);
+  }
+  constexpr iterator end() const noexcept {
+    return iterator(data_, stride_, size_);
+  }
+
+  constexpr bool empty() const noexcept { return size_ == 0; }
+  constexpr size_type size() const noexcept { return size_; }
+  constexpr size_type stride() const noexcept { return stride_; }
+
+  constexpr strided_view first(size_type count) const;
+  constexpr strided_view last(size_type count) const;
+  constexpr strided_view subview(size_type offset,
+                                 size_type count = dynamic_extent) const;
+
+ private:
+  T *data_ = nullptr;
+  size_type stride_ = 1;
+  size_type size_ = 0;
+
+  constexpr strided_view(T *data, size_type stride, size_type size) noexcept
+      : data_(data), stride_(stride), size_(size) {}
+};
+
+template <typename T>
+constexpr strided_view<T>::strided_view(span<T> elements, size_type stride)
+    : data_(elements.data()), stride_(stride) {
+  if (stride == 0) throw std::invalid_argument("Stride must be positive");
+  size_ = elements.empty() ? 0 : (elements.size() - 1) / stride + 1;
+}
+
+template <typename T>
+constexpr strided_view<T> strided_view<T>::first(size_type count) const {
+  return subview(0, count);
+}
+
+template <typename T>
+constexpr strided_view<T> strided_view<T>::last(size_type count) const {
+  if (count > size_) throw std::out_of_range("Index out of range");
+  return subview(size_ - count, count);
+}
+
+// An empty slice keeps the old start, as offset * stride may lie past the
+// storage.
+template <typename T>
+constexpr strided_view<T> strided_view<T>::subview(size_type offset,
+                                                   size_type count) const {
+  if (offset > size_) throw std::out_of_range("Index out of range");
+  if (count == dynamic_extent) count = size_ - offset;
+  if (count > size_ - offset) throw std::out_of_range("Index out of range");
+  return strided_view(count > 0 ? data_ + offset * stride_ : data_, stride_,
+                      count);
+}
+
+// An iterator over the chunks of a chunk_view. Dereferencing it gives a
+// span by value, not a reference, so it is only an input iterator, as
+// soa_iterator is, even though it can jump and be subtracted in O(1).
+template <typename T>
+class chunk_iterator {
+ public:
+  using iterator_category = std::input_iterator_tag;
+  using value_type = span<T>;
+  using difference_type = ptrdiff_t;
+  using pointer = void;
+  using reference = span<T>;
+
+  constexpr chunk_iterator() noexcept = default;
+  constexpr chunk_iterator(span<T> elements, size_t chunk_size,
+                           size_t index) noexcept
+      : elements_(elements), chunk_size_(chunk_size), index_(index) {}
+
+  constexpr reference operator*() const { return (*this)[0]; }
+  constexpr reference operator[](difference_type n) const {
+    size_t offset = (index_ + n) * chunk_size_;
+    size_t count = elements_.size() - offset;
+    return span<T>(elements_.data() + offset,
+                   count < chunk_size_ ? count : chunk_size_);
+  }
+
+  constexpr chunk_iterator &operator++() noexcept {
+    ++index_;
+    return *this;
+  }
+  constexpr chunk_iterator operator++(int) noexcept {
+    chunk_iterator old = *this;
+    ++index_;
+    return old;
+  }
+  constexpr chunk_iterator &operator--() noexcept {
+    --index_;
+    return *this;
+  }
+  constexpr chunk_iterator operator--(int) noexcept {
+    chunk_iterator old = *this;
+    --index_;
+    return old;
+  }
+  constexpr chunk_iterator &operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+  }
+  constexpr chunk_iterator &operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+  }
+  constexpr chunk_iterator operator+(difference_type n) const noexcept {
+    return chunk_iterator(elements_, chunk_size_, index_ + n);
+  }
+  friend constexpr chunk_iterator operator+(
+      difference_type n, const chunk_iterator &it) noexcept {
+    return it + n;
+  }
+  constexpr chunk_iterator operator-(difference_type n) const noexcept {
+    return chunk_iterator(elements_, chunk_size_, index_ - n);
+  }
+  constexpr difference_type operator-(
+      const chunk_iterator &other) const noexcept {
+    return difference_type(index_) - difference_type(other.index_);
+  }
+
+  constexpr bool operator==(const chunk_iterator &other) const noexcept {
+    return index_ == other.index_;
+  }
+  constexpr bool operator!=(const chunk_iterator &other) const noexcept {
+    return index_ != other.index_;
+  }
+  constexpr bool operator<(const chunk_iterator &other) const noexcept {
+    return index_ < other.index_;
+  }
+  constexpr bool operator>(const chunk_iterator &other) const noexcept {
+    return index_ > other.index_;
+  }
+  constexpr bool operator<=(const chunk_iterator &other) const noexcept {
+    return index_ <= other.index_;
+  }
+  constexpr bool operator>=(const chunk_iterator &other) const noexcept {
+    return index_ >= other.index_;
+  }
+
+ private:
+  span<T> elements_;
+  size_t chunk_size_ = 1;
+  size_t index_ = 0;
+};
+
+// A span cut into consecutive spans of chunk_size elements; the last one
+// is shorter when chunk_size does not divide the size. A chunk size of zero
+// throws std::invalid_argument. first(), last() and subview() slice it by
+// chunk, as the span ones do by element.
+template <typename T>
+class chunk_view {
+ public:
+  using value_type = span<T>;
+  using iterator = chunk_iterator<T>;
+  using size_type = size_t;
+
+  constexpr chunk_view() noexcept = default;
+  constexpr chunk_view(span<T> elements, size_type chunk_size);
+
+  constexpr span<T> at(size_type pos) const {
+    if (pos >= size()) throw std::out_of_range("Index out of range");
+    return begin()[pos];
+  }
+  constexpr span<T> operator[](size_type pos) const { return begin()[pos]; }
+
+  constexpr iterator begin() const noexcept {
+    return iterator(elements_, chunk_size_, 0);
+  }
+  constexpr iterator end() const noexcept {
+    return iterator(elements_, chunk_size_, size());
+  }
+
+  constexpr bool empty() const noexcept { return elements_.empty(); }
+  constexpr size_type size() const noexcept {
+    return elements_.empty() ? 0 : (elements_.size() - 1) / chunk_size_ + 1;
+  }
+  constexpr size_type chunk_size() const noexcept { return chunk_size_; }
+
+  constexpr chunk_view first(size_type count) const;
+  constexpr chunk_view last(size_type count) const;
+  constexpr chunk_view subview(size_type offset,
+                               size_type count = dynamic_extent) const;
+
+ private:
+  span<T> elements_;
+  size_type chunk_size_ = 1;
+};
+
+template <typename T>
+constexpr chunk_view<T>::chunk_view(span<T> elements, size_type chunk_size)
+    : elements_(elements), chunk_size_(chunk_size) {
+  if (chunk_size == 0) {
+    throw std::invalid_argument("Chunk size must be positive");
+  }
+}
+
+template <typename T>
+constexpr chunk_view<T> chunk_view<T>::first(size_type count) const {
+  return subview(0, count);
+}
+
+template <typename T>
+constexpr chunk_view<T> chunk_view<T>::last(size_type count) const {
+  if (count > size()) throw std::out_of_range("Index out of range");
+  return subview(size() - count, count);
+}
+
+// The slice ending with the last chunk keeps its short tail; any other end
+// is a whole number of chunks before the end of the elements.
+template <typename T>
+constexpr chunk_view<T> chunk_view<T>::subview(size_type offset,
+                                               size_type count) const {
+  size_type chunks = size();
+  if (offset > chunks) throw std::out_of_range("Index out of range");
+  if (count == dynamic_extent) count = chunks - offset;
+  if (count > chunks - offset) throw std::out_of_range("Index out of range");
+  if (count == 0) return chunk_view(elements_.first(0), chunk_size_);
+  size_type first = offset * chunk_size_;
+  size_type last = (offset + count == chunks ? elements_.size()
+                                             : (offset + count) * chunk_size_);
+  return chunk_view(elements_.subspan(first, last - first), chunk_size_);
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERSPLUS_S21_SPAN_H
@@ -0,0 +1,255 @@
+#ifndef S21_CONTAINERSPLUS_S21_THREAD_POOL_H
+#define S21_CONTAINERSPLUS_S21_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "../s21_containers/s21_vector.h"
+
+namespace s21 {
+// A fixed set of worker threads, each with its own task deque. A worker
+// takes the newest task from its own deque and, when that is empty, steals
+// the oldest task from another one, so forked subtasks stay on the thread
+// that made them while idle threads pick up the large, early pieces. Tasks
+// submitted from outside the pool are dealt round-robin. A pool of no
+// threads keeps one deque, whose tasks run on the threads that wait.
+//
+// Tasks given to submit() must not throw; use task_group to run work that
+// may, and to wait for it.
+class thread_pool {
+ public:
+  using size_type = size_t;
+
+  explicit thread_pool(size_type threads = default_thread_count());
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+  ~thread_pool();
+
+  size_type size() const noexcept;
+
+  void submit(std::function<void()> task);
+  bool run_pending_task();
+
+  static size_type default_thread_count() noexcept;
+  static thread_pool &default_pool();
+
+ private:
+  struct queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  // The pool and deque of the worker running on the calling thread.
+  struct worker_slot {
+    thread_pool *pool = nullptr;
+    size_type index = 0;
+  };
+
+  std::unique_ptr<queue[]> queues_;
+  size_type queue_count_;
+  s21::vector<std::thread> workers_;
+  std::atomic<size_type> pending_{0};
+  std::atomic<size_type> next_queue_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stopping_ = false;
+
+  // ADDITIONAL FUNCTIONS
+  static worker_slot &current_worker() noexcept;
+  void stop() noexcept;
+  bool take_task(size_type index, bool own, std::function<void()> &task);
+  void work(size_type index);
+};
+
+// Tasks forked onto a thread_pool and joined together. wait() runs queued
+// tasks on the calling thread until the group is done, so a task may fork
+// and wait on a group of its own without starving the pool, and rethrows
+// the first exception any task of the group threw.
+class task_group {
+ public:
+  explicit task_group(thread_pool &pool = thread_pool::default_pool())
+      : pool_(pool) {}
+  task_group(const task_group &) = delete;
+  task_group &operator=(const task_group &) = delete;
+  ~task_group() { join(); }
+
+  template <typename Function>
+  void run(Function function);
+  void wait();
+
+ private:
+  thread_pool &pool_;
+  std::atomic<size_t> pending_{0};
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+
+  // ADDITIONAL FUNCTIONS
+  std::exception_ptr join() noexcept;
+};
+
+inline thread_pool::thread_pool(size_type threads)
+    : queues_(new queue[threads ? threads : 1]),
+      queue_count_(threads ? threads : 1) {
+  workers_.reserve(threads);
+  try {
+    for (size_type i = 0; i < threads; ++i) {
+      workers_.emplace_back([this, i] { work(i); });
+    }
+  } catch (...) {
+    stop();
+    throw;
+  }
+}
+
+inline thread_pool::~thread_pool() { stop(); }
+
+inline thread_pool::size_type thread_pool::size() const noexcept {
+  return workers_.size();
+}
+
+inline void thread_pool::submit(std::function<void()> task) {
+  worker_slot &slot = current_worker();
+  size_type index = slot.pool == this
+                        ? slot.index
+                        : next_queue_.fetch_add(1, std::memory_order_relaxed) %
+                              queue_count_;
+  {
+    std::lock_guard<std::mutex> lock(queues_[index].mutex);
+    queues_[index].tasks.push_back(std::move(task));
+  }
+  pending_.fetch_add(1, std::memory_order_release);
+  // Taking the lock orders the count above before a worker's check of it,
+  // so a worker about to sleep cannot miss the wakeup.
+  { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+  wake_.notify_one();
+}
+
+// Runs one queued task on the calling thread; false if there was none.
+inline bool thread_pool::run_pending_task() {
+  worker_slot &slot = current_worker();
+  bool own = slot.pool == this;
+  std::function<void()> task;
+  if (!take_task(own ? slot.index : 0, own, task)) return false;
+  task();
+  return true;
+}
+
+inline thread_pool::size_type thread_pool::default_thread_count() noexcept {
+  unsigned threads = std::thread::hardware_concurrency();
+  return threads ? threads : 1;
+}
+
+// One worker fewer than there are cores: the thread that waits on a
+// task_group runs tasks as well.
+inline thread_pool &thread_pool::default_pool() {
+  static thread_pool pool(default_thread_count() - 1);
+  return pool;
+}
+
+// ADDITIONAL FUNCTIONS
+
+inline thread_pool::worker_slot &thread_pool::current_worker() noexcept {
+  thread_local worker_slot slot;
+  return slot;
+}
+
+// Lets the workers drain the queues, then joins them.
+inline void thread_pool::stop() noexcept {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread &worker : workers_) {
+    if (worker.joinable()) worker.join();
+  }
+}
+
+inline bool thread_pool::take_task(size_type index, bool own,
+                                   std::function<void()> &task) {
+  if (pending_.load(std::memory_order_acquire) == 0) return false;
+  for (size_type step = 0; step < queue_count_; ++step) {
+    queue &victim = queues_[(index + step) % queue_count_];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (victim.tasks.empty()) continue;
+    if (own && step == 0) {
+      task = std::move(victim.tasks.back());
+      victim.tasks.pop_back();
+    } else {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+    }
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+  }
+  return false;
+}
+
+inline void thread_pool::work(size_type index) {
+  current_worker() = worker_slot{this, index};
+  std::function<void()> task;
+  for (;;) {
+    if (take_task(index, true, task)) {
+      task();
+      task = nullptr;
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    wake_.wait(lock, [this] {
+      return stopping_ || pending_.load(std::memory_order_acquire) > 0;
+    });
+    if (stopping_ && pending_.load(std::memory_order_acquire) == 0) return;
+  }
+}
+
+template <typename Function>
+void task_group::run(Function function) {
+  pending_.fetch_add(1, std::memory_order_relaxed);
+  try {
+    pool_.submit([this, function]() mutable {
+      try {
+        function();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        if (!error_) error_ = std::current_exception();
+      }
+      // The last touch of the group: wait() may return right after it.
+      pending_.fetch_sub(1, std::memory_order_release);
+    });
+  } catch (...) {
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    throw;
+  }
+}
+
+inline void task_group::wait() {
+  std::exception_ptr error = join();
+  if (error) std::rethrow_exception(error);
+}
+
+// ADDITIONAL FUNCTIONS
+
+inline std::exception_ptr task_group::join() noexcept {
+  while (pending_.load(std::memory_order_acquire) > 0) {
+    bool ran = false;
+    try {
+      ran = pool_.run_pending_task();
+    } catch (...) {
+      // Only std::function's moves can throw here; the tasks cannot.
+    }
+    if (!ran) std::this_thread::yield();
+  }
+  std::lock_guard<std::mutex> lock(error_mutex_);
+  return std::exchange(error_, nullptr);
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERSPLUS_S21_THREAD_POOL_H
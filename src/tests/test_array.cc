@@ -161,6 +161,64 @@ TEST(array, Fill) {
   EXPECT_EQ(s21_array.size(), std_array.size());
 }
 
+namespace {
+// A table of squares, sorted descending and searched at compile time.
+constexpr s21::array<int, 8> SquaresDescending() {
+  s21::array<int, 8> table{};
+  for (int i = 0; i < 8; ++i) table[i] = i * i;
+  s21::sort(table, std::greater<>());
+  return table;
+}
+
+constexpr s21::array<int, 8> kSquares = SquaresDescending();
+static_assert(kSquares.front() == 49 && kSquares.back() == 0);
+static_assert(*s21::find(kSquares, 25) == 25);
+static_assert(s21::find(kSquares, 26) == kSquares.end());
+static_assert(kSquares.size() == 8 && !kSquares.empty());
+
+constexpr s21::array<char, 4> Filled(char value) {
+  s21::array<char, 4> filled{};
+  filled.fill(value);
+  return filled;
+}
+static_assert(Filled('x').at(3) == 'x');
+}  // namespace
+
+TEST(array, ConstexprTable) {
+  EXPECT_EQ(kSquares[1], 36);
+  EXPECT_EQ(s21::find(kSquares, 16) - kSquares.begin(), 3);
+  EXPECT_THROW(kSquares.at(8), std::out_of_range);
+}
+
+TEST(array, CopyAndConstAccess) {
+  s21::array<std::string, 3> words = {"a", "b"};
+  s21::array<std::string, 3> copy(words);
+  EXPECT_EQ(copy[1], "b");
+  EXPECT_EQ(words[1], "b");
+  copy = words;
+  const s21::array<std::string, 3> &constant = copy;
+  EXPECT_EQ(constant.front(), "a");
+  EXPECT_TRUE(constant.back().empty());
+  EXPECT_EQ(constant.cend() - constant.cbegin(), 3);
+  EXPECT_EQ(*constant.data(), "a");
+  EXPECT_EQ(s21::find(constant, "b"), constant.begin() + 1);
+  auto too_many = [] { s21::array<int, 2> small = {1, 2, 3}; };
+  EXPECT_THROW(too_many(), std::length_error);
+}
+
+TEST(array, AlignmentAndRuntimeAlgorithms) {
+  s21::array<float, 19, 64> aligned;
+  static_assert(alignof(decltype(aligned)) == 64);
+  static_assert(decltype(aligned)::alignment == 64);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned.data()) % 64, 0U);
+  aligned.fill(2.5f);
+  aligned[7] = -1.0f;
+  s21::sort(aligned);
+  EXPECT_EQ(aligned[0], -1.0f);
+  EXPECT_EQ(s21::find(aligned, 2.5f), aligned.begin() + 1);
+  EXPECT_EQ(s21::find(aligned, 3.0f), aligned.end());
+}
+
 // int main(int argc, char **argv) {
 //     ::testing::InitGoogleTest(&argc, argv);
 //     return RUN_ALL_TESTS();
@@ -0,0 +1,103 @@
+#include "test_entry.h"
+
+TEST(bit_vector, PushBackAndAccess) {
+  s21::bit_vector bits;
+  std::vector<bool> expected;
+  for (int i = 0; i < 1000; ++i) {
+    bool value = (i % 3 == 0) || (i % 7 == 0);
+    bits.push_back(value);
+    expected.push_back(value);
+  }
+  EXPECT_EQ(bits.size(), 1000U);
+  EXPECT_EQ(bits.word_count(), 16U);
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(bits[i], expected[i]);
+  EXPECT_EQ(bits.count(),
+            size_t(std::count(expected.begin(), expected.end(), true)));
+  EXPECT_TRUE(bits.front());
+  EXPECT_TRUE(bits.back());
+  EXPECT_ANY_THROW(bits.at(1000));
+
+  bits[1] = true;
+  bits[0] = bits[2];
+  bits[3].flip();
+  EXPECT_TRUE(bits.test(1));
+  EXPECT_FALSE(bits.test(0));
+  EXPECT_FALSE(bits.test(3));
+  bits.pop_back();
+  EXPECT_EQ(bits.size(), 999U);
+}
+
+TEST(bit_vector, ResizeKeepsTailClear) {
+  s21::bit_vector bits(70, true);
+  EXPECT_EQ(bits.count(), 70U);
+  EXPECT_TRUE(bits.all());
+  EXPECT_EQ(bits.words()[1], 0x3FU);
+  bits.resize(65);
+  EXPECT_EQ(bits.count(), 65U);
+  bits.resize(200, true);
+  EXPECT_EQ(bits.count(), 200U);
+  bits.resize(300);
+  EXPECT_EQ(bits.count(), 200U);
+  bits.flip();
+  EXPECT_EQ(bits.count(), 100U);
+  EXPECT_FALSE(bits[199]);
+  EXPECT_TRUE(bits[299]);
+  bits.reset();
+  EXPECT_TRUE(bits.none());
+  bits.set();
+  EXPECT_EQ(bits.count(), 300U);
+  bits.clear();
+  EXPECT_TRUE(bits.empty());
+  EXPECT_TRUE(bits.all());
+}
+
+TEST(bit_vector, BulkOperations) {
+  s21::bit_vector a(130), b(130);
+  for (size_t i = 0; i < 130; ++i) {
+    a[i] = (i % 2 == 0);
+    b[i] = (i % 3 == 0);
+  }
+  s21::bit_vector both = a & b;
+  s21::bit_vector either = a | b;
+  s21::bit_vector one = a ^ b;
+  for (size_t i = 0; i < 130; ++i) {
+    EXPECT_EQ(both[i], i % 6 == 0);
+    EXPECT_EQ(either[i], i % 2 == 0 || i % 3 == 0);
+    EXPECT_EQ(one[i], (i % 2 == 0) != (i % 3 == 0));
+  }
+  EXPECT_EQ((~a).count(), 65U);
+  EXPECT_EQ(~~a, a);
+  EXPECT_NE(a, b);
+  s21::bit_vector shorter(129);
+  EXPECT_THROW(a &= shorter, std::invalid_argument);
+}
+
+TEST(bit_vector, RankSelect) {
+  s21::bit_vector bits(100000);
+  std::vector<size_t> ones;
+  for (size_t i = 0; i < bits.size(); ++i) {
+    if ((i * 2654435761U) % 7 < 2) {
+      bits[i] = true;
+      ones.push_back(i);
+    }
+  }
+  for (bool indexed : {false, true}) {
+    if (indexed) bits.build_index();
+    EXPECT_EQ(bits.has_index(), indexed);
+    EXPECT_EQ(bits.count(), ones.size());
+    size_t rank = 0;
+    for (size_t i = 0; i <= bits.size(); i += 37) {
+      while (rank < ones.size() && ones[rank] < i) ++rank;
+      EXPECT_EQ(bits.rank1(i), rank);
+    }
+    EXPECT_EQ(bits.rank1(bits.size()), ones.size());
+    for (size_t k = 0; k < ones.size(); k += 11) {
+      EXPECT_EQ(bits.select1(k), ones[k]);
+    }
+    EXPECT_EQ(bits.select1(ones.size() - 1), ones.back());
+    EXPECT_THROW(bits.select1(ones.size()), std::out_of_range);
+    EXPECT_THROW(bits.rank1(bits.size() + 1), std::out_of_range);
+  }
+  bits[0] = !bits[0];
+  EXPECT_FALSE(bits.has_index());
+}
@@ -8,6 +8,7 @@
 #include <map>
 #include <queue>
 #include <set>
+#include <sstream>
 #include <stack>
 #include <vector>
 
@@ -0,0 +1,59 @@
+#include "test_entry.h"
+
+namespace {
+using HugeVector = s21::vector<float, s21::hugepage_allocator<float>>;
+
+void FillAndCheck(HugeVector &vector, size_t size) {
+  for (size_t i = 0; i < size; ++i) vector.push_back(float(i % 1000));
+  ASSERT_EQ(vector.size(), size);
+  for (size_t i = 0; i < size; i += 4099) {
+    EXPECT_EQ(vector[i], float(i % 1000));
+  }
+}
+}  // namespace
+
+TEST(hugepage_allocator, SmallBuffersUseHeap) {
+  HugeVector vector;
+  FillAndCheck(vector, 1000);
+  EXPECT_EQ(vector.back(), 999.0f);
+}
+
+TEST(hugepage_allocator, LargeBuffersAreMapped) {
+  HugeVector vector;
+  vector.reserve(size_t(1) << 20);
+  auto address = reinterpret_cast<uintptr_t>(vector.data());
+#if defined(__linux__)
+  EXPECT_EQ(address % 4096, 0U);
+#endif
+  FillAndCheck(vector, (size_t(1) << 20) + 17);
+  vector.shrink_to_fit();
+  EXPECT_EQ(vector.capacity(), vector.size());
+  EXPECT_EQ(vector[1000], 0.0f);
+}
+
+TEST(hugepage_allocator, ExplicitPagesFallBack) {
+  s21::hugepage_options options;
+  options.explicit_pages = true;
+  options.threshold = 4096;
+  HugeVector vector{s21::hugepage_allocator<float>(options)};
+  FillAndCheck(vector, 300000);
+  HugeVector copy(vector);
+  EXPECT_EQ(copy[299999], vector[299999]);
+}
+
+TEST(hugepage_allocator, NumaPolicy) {
+  s21::hugepage_options options;
+  options.threshold = 4096;
+  options.policy = s21::numa_policy::interleave;
+  options.node_mask = 1;
+  HugeVector vector{s21::hugepage_allocator<float>(options)};
+  FillAndCheck(vector, 200000);
+
+  options.policy = s21::numa_policy::bind;
+  HugeVector bound{s21::hugepage_allocator<float>(options)};
+  FillAndCheck(bound, 200000);
+  bound = vector;
+  EXPECT_EQ(bound.get_allocator().options().policy,
+            s21::numa_policy::interleave);
+  EXPECT_EQ(bound[199999], vector[199999]);
+}
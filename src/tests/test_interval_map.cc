@@ -0,0 +1,82 @@
+#include "test_entry.h"
+
+namespace {
+std::set<std::pair<int, int>> BruteOverlap(
+    const std::set<std::pair<int, int>> &intervals, int lo, int hi) {
+  std::set<std::pair<int, int>> found;
+  for (const auto &interval : intervals)
+    if (interval.first <= hi && interval.second >= lo) found.insert(interval);
+  return found;
+}
+}  // namespace
+
+TEST(interval_map, ConstructorDefault) {
+  s21::interval_map<int, int> my_map;
+  EXPECT_TRUE(my_map.empty());
+  EXPECT_EQ(my_map.size(), 0U);
+  EXPECT_TRUE(my_map.overlapping(0, 100).empty());
+}
+
+TEST(interval_map, ConstructorInitializer) {
+  s21::interval_map<int, char> my_map = {
+      {{1, 5}, 'a'}, {{3, 9}, 'b'}, {{12, 14}, 'c'}, {{1, 5}, 'd'}};
+  EXPECT_EQ(my_map.size(), 3U);
+  EXPECT_EQ((*my_map.find(1, 5)).second, 'a');
+  EXPECT_TRUE(my_map.contains(12, 14));
+  EXPECT_FALSE(my_map.contains(12, 15));
+}
+
+TEST(interval_map, Stabbing) {
+  s21::interval_map<int, int> my_map = {
+      {{1, 5}, 0}, {{3, 9}, 1}, {{6, 7}, 2}, {{10, 10}, 3}};
+  auto found = my_map.stabbing(6);
+  ASSERT_EQ(found.size(), 2U);
+  EXPECT_EQ((*found[0]).second, 1);
+  EXPECT_EQ((*found[1]).second, 2);
+  EXPECT_EQ(my_map.stabbing(10).size(), 1U);
+  EXPECT_TRUE(my_map.stabbing(11).empty());
+}
+
+TEST(interval_map, InsertInvalid) {
+  s21::interval_map<int, int> my_map;
+  EXPECT_THROW(my_map.insert(5, 1, 0), std::invalid_argument);
+}
+
+TEST(interval_map, OverlapMatchesScan) {
+  s21::interval_map<int, int> my_map;
+  std::set<std::pair<int, int>> orig;
+  unsigned seed = 12345;
+  auto next = [&seed] {
+    seed = seed * 1103515245 + 12345;
+    return static_cast<int>((seed >> 8) % 1000);
+  };
+  for (int i = 0; i < 600; ++i) {
+    int lo = next(), len = next() % 50;
+    bool inserted = my_map.insert(lo, lo + len, i).second;
+    EXPECT_EQ(inserted, orig.insert({lo, lo + len}).second);
+  }
+  int erased = 0;
+  for (auto it = orig.begin(); it != orig.end(); ++erased) {
+    if (erased % 3 == 0) {
+      EXPECT_TRUE(my_map.erase(it->first, it->second));
+      it = orig.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  EXPECT_EQ(my_map.size(), orig.size());
+  for (int i = 0; i < 200; ++i) {
+    int lo = next(), hi = lo + next() % 30;
+    std::set<std::pair<int, int>> found;
+    for (auto &it : my_map.overlapping(lo, hi)) found.insert((*it).first);
+    EXPECT_EQ(found, BruteOverlap(orig, lo, hi));
+  }
+}
+
+TEST(interval_map, CopyKeepsQueries) {
+  s21::interval_map<int, int> my_map = {{{1, 100}, 0}, {{2, 3}, 1}};
+  s21::interval_map<int, int> my_copy(my_map);
+  my_map.erase(my_map.find(1, 100));
+  EXPECT_EQ(my_copy.stabbing(50).size(), 1U);
+  EXPECT_TRUE(my_map.stabbing(50).empty());
+}
@@ -246,3 +246,199 @@ TEST(map, InsMany) {
   copy = set;
   copy2 = std::move(set);
 }
+
+TEST(map, CopyLargeMap) {
+  s21::map<int, int> my_map;
+  std::map<int, int> orig_map;
+  for (int i = 0; i < 2000; ++i) {
+    my_map.insert(i * 7 % 10007, i);
+    orig_map.insert({i * 7 % 10007, i});
+  }
+  s21::map<int, int> my_copy(my_map);
+  EXPECT_EQ(my_copy.size(), orig_map.size());
+  for (int i = 0; i < 2000; i += 3) {
+    my_copy.erase(my_copy.find(i * 7 % 10007));
+    orig_map.erase(i * 7 % 10007);
+  }
+  for (int i = 20000; i < 20100; ++i) {
+    my_copy.insert(i, i);
+    orig_map.insert({i, i});
+  }
+  EXPECT_EQ(my_copy.size(), orig_map.size());
+  auto my_it = my_copy.begin();
+  auto orig_it = orig_map.begin();
+  for (; my_it != my_copy.end(); ++my_it, ++orig_it) {
+    EXPECT_EQ((*my_it).first, (*orig_it).first);
+    EXPECT_EQ((*my_it).second, (*orig_it).second);
+  }
+  EXPECT_EQ(my_map.size(), 2000U);
+}
+
+TEST(map, CopyAfterTreeRemoveMap) {
+  s21::map<int, int> my_map;
+  for (int i = 0; i < 8; ++i) my_map.insert(i, i);
+  s21::Tree<int, int> &tree = my_map;
+  EXPECT_TRUE(tree.remove(3));
+  EXPECT_FALSE(tree.remove(3));
+  EXPECT_EQ(my_map.size(), 7U);
+  s21::map<int, int> my_copy(my_map);
+  EXPECT_EQ(my_copy.size(), 7U);
+  size_t visited = 0;
+  for (auto it = my_copy.begin(); it != my_copy.end(); ++it) ++visited;
+  EXPECT_EQ(visited, 7U);
+  for (int i = 0; i < 8; ++i) {
+    if (i != 3) my_copy.erase(my_copy.find(i));
+  }
+  EXPECT_TRUE(my_copy.empty());
+}
+
+TEST(map, MoveAssignMap) {
+  s21::map<int, char> my_map = {{1, 'a'}, {2, 'b'}, {3, 'c'}};
+  s21::map<int, char> my_copy(my_map);
+  s21::map<int, char> my_target = {{7, 'z'}};
+  my_target = std::move(my_copy);
+  EXPECT_EQ(my_target.size(), 3U);
+  EXPECT_EQ(my_target.at(2), 'b');
+  EXPECT_FALSE(my_target.contains(7));
+}
+
+TEST(map, BulkBuildMap) {
+  s21::vector<std::pair<int, int>> items;
+  std::map<int, int> orig_map;
+  for (int i = 0; i < 50000; ++i) {
+    int key = (i * 7919) % 40009;
+    items.push_back({key, i});
+    orig_map.insert({key, i});
+  }
+  s21::map<int, int> my_map(std::move(items));
+  EXPECT_EQ(my_map.size(), orig_map.size());
+  auto my_it = my_map.begin();
+  auto orig_it = orig_map.begin();
+  for (; my_it != my_map.end(); ++my_it, ++orig_it) {
+    EXPECT_EQ((*my_it).first, (*orig_it).first);
+    EXPECT_EQ((*my_it).second, (*orig_it).second);
+  }
+  my_map.insert(-1, 1);
+  my_map.erase(my_map.find(0));
+  EXPECT_TRUE(my_map.contains(-1));
+  EXPECT_FALSE(my_map.contains(0));
+}
+
+TEST(map, BulkBuildEmptyMap) {
+  s21::map<int, int> my_map(s21::vector<std::pair<int, int>>{});
+  EXPECT_TRUE(my_map.empty());
+}
+
+TEST(map, ParallelOperationsMap) {
+  s21::vector<std::pair<int, long>> items;
+  for (int i = 0; i < 30000; ++i) items.push_back({i, i});
+  s21::map<int, long> my_map(items);
+  my_map.parallel_for_each([](const int &, long &data) { data *= 2; });
+  EXPECT_EQ(my_map.at(100), 200);
+  auto even = my_map.parallel_count_if(
+      [](const int &key, const long &) { return key % 2 == 0; });
+  EXPECT_EQ(even, 15000U);
+  long sum = my_map.parallel_reduce(
+      0L, [](long a, long b) { return a + b; },
+      [](const int &, const long &data) { return data; });
+  EXPECT_EQ(sum, 30000L * 29999L);
+}
+
+namespace {
+struct KeyConcat {
+  using value_type = std::string;
+  static value_type identity() { return std::string(); }
+  static value_type combine(const std::string &a, const std::string &b) {
+    return a + b;
+  }
+  static value_type lift(const char &key, const int &) {
+    return std::string(1, key);
+  }
+};
+}  // namespace
+
+TEST(map, AggregateSumMap) {
+  s21::map<int, long, s21::monoid_augment<s21::sum_monoid<long>>> my_map;
+  std::map<int, long> orig_map;
+  for (int i = 0; i < 500; ++i) {
+    int key = (i * 37) % 503;
+    my_map.insert(key, i);
+    orig_map.insert({key, i});
+  }
+  for (int key = 0; key < 503; key += 5) {
+    if (!orig_map.count(key)) continue;
+    my_map.erase(my_map.find(key));
+    orig_map.erase(key);
+  }
+  my_map.insert_or_assign(1, 1000);
+  orig_map[1] = 1000;
+  for (int lo = -3; lo < 510; lo += 17) {
+    for (int hi = lo; hi < 520; hi += 41) {
+      long expected = 0;
+      for (auto it = orig_map.lower_bound(lo);
+           it != orig_map.end() && it->first <= hi; ++it)
+        expected += it->second;
+      EXPECT_EQ(my_map.aggregate(lo, hi), expected);
+    }
+  }
+  long total = 0;
+  for (auto &item : orig_map) total += item.second;
+  EXPECT_EQ(my_map.aggregate(), total);
+}
+
+TEST(map, AggregateMinMaxMap) {
+  s21::map<int, int, s21::monoid_augment<s21::min_monoid<int>>> my_min = {
+      {1, 50}, {2, 10}, {3, 70}, {4, 5}};
+  s21::map<int, int, s21::monoid_augment<s21::max_monoid<int>>> my_max = {
+      {1, 50}, {2, 10}, {3, 70}, {4, 5}};
+  EXPECT_EQ(my_min.aggregate(1, 3), 10);
+  EXPECT_EQ(my_max.aggregate(1, 2), 50);
+  EXPECT_EQ(my_min.aggregate(7, 9), std::numeric_limits<int>::max());
+}
+
+TEST(map, AggregateKeepsOrderMap) {
+  s21::map<char, int, s21::monoid_augment<KeyConcat>> my_map;
+  std::string letters = "qwertyuiopasdfghjklzxcvbnm";
+  for (char letter : letters) my_map.insert(letter, 0);
+  EXPECT_EQ(my_map.aggregate('c', 'k'), "cdefghijk");
+  EXPECT_EQ(my_map.aggregate(), "abcdefghijklmnopqrstuvwxyz");
+}
+
+TEST(map, ThreadedIterationMap) {
+  s21::map<int, int, s21::threaded_links<>> my_map;
+  std::map<int, int> orig_map;
+  for (int i = 0; i < 1000; ++i) {
+    int key = (i * 389) % 1009;
+    my_map.insert(key, i);
+    orig_map.insert({key, i});
+  }
+  for (int key = 0; key < 1009; key += 4) {
+    if (!orig_map.count(key)) continue;
+    my_map.erase(my_map.find(key));
+    orig_map.erase(key);
+  }
+  s21::map<int, int, s21::threaded_links<>> my_copy(my_map);
+  for (auto *tree : {&my_map, &my_copy}) {
+    auto my_it = tree->begin();
+    auto orig_it = orig_map.begin();
+    for (; my_it != tree->end(); ++my_it, ++orig_it) {
+      EXPECT_EQ((*my_it).first, (*orig_it).first);
+      EXPECT_EQ((*my_it).second, (*orig_it).second);
+    }
+    EXPECT_TRUE(orig_it == orig_map.end());
+  }
+  auto my_it = my_map.find(orig_map.rbegin()->first);
+  auto orig_it = orig_map.rbegin();
+  for (int i = 0; i < 10; ++i, --my_it, ++orig_it)
+    EXPECT_EQ((*my_it).first, orig_it->first);
+}
+
+TEST(map, ThreadedBulkBuildMap) {
+  s21::vector<std::pair<int, int>> items;
+  for (int i = 99; i >= 0; --i) items.push_back({i, i});
+  s21::map<int, int, s21::threaded_links<>> my_map(items);
+  int expected = 0;
+  for (auto it = my_map.begin(); it != my_map.end(); ++it)
+    EXPECT_EQ((*it).first, expected++);
+  EXPECT_EQ(expected, 100);
+}
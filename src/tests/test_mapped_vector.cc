@@ -0,0 +1,133 @@
+#include "test_entry.h"
+
+namespace {
+struct Record {
+  int id;
+  double value;
+};
+
+std::string TempPath(const char *name) {
+  std::string path = ::testing::TempDir() + name;
+  ::unlink(path.c_str());
+  return path;
+}
+}  // namespace
+
+TEST(mapped_vector, WriteAndReopen) {
+  std::string path = TempPath("s21_mapped_records");
+  {
+    s21::mapped_vector<Record, s21::map_mode::read_write> records(path);
+    EXPECT_TRUE(records.empty());
+    for (int i = 0; i < 10000; ++i) records.push_back({i, i * 0.5});
+    EXPECT_EQ(records.size(), 10000U);
+    EXPECT_GE(records.capacity(), 10000U);
+    records[5].value = -1.0;
+  }
+  s21::mapped_vector<Record> records(path);
+  ASSERT_EQ(records.size(), 10000U);
+  EXPECT_EQ(records.capacity(), 10000U);
+  EXPECT_EQ(records.front().id, 0);
+  EXPECT_EQ(records.back().id, 9999);
+  EXPECT_EQ(records[5].value, -1.0);
+  EXPECT_EQ(records.at(100).value, 50.0);
+  EXPECT_ANY_THROW(records.at(10000));
+  int sum = 0;
+  for (const Record &record : records) sum += record.id % 2;
+  EXPECT_EQ(sum, 5000);
+  ::unlink(path.c_str());
+}
+
+TEST(mapped_vector, ReadOnlyCannotGrow) {
+  std::string path = TempPath("s21_mapped_read_only");
+  {
+    s21::mapped_vector<int, s21::map_mode::read_write> numbers(path);
+    numbers.push_back(1);
+    // The first growth fills exactly one page.
+    EXPECT_EQ(numbers.capacity() * sizeof(int), 4096U);
+  }
+  s21::mapped_vector<int> numbers(path);
+  static_assert(numbers.mode() == s21::map_mode::read_only);
+  // Writes to the read-only mapping do not compile.
+  static_assert(std::is_same_v<decltype(numbers[0]), const int &>);
+  static_assert(std::is_same_v<decltype(numbers.begin()), const int *>);
+  static_assert(std::is_same_v<decltype(numbers.back()), const int &>);
+  EXPECT_THROW(numbers.push_back(2), std::logic_error);
+  EXPECT_THROW(numbers.resize(10), std::logic_error);
+  EXPECT_EQ(numbers.size(), 1U);
+  ::unlink(path.c_str());
+}
+
+TEST(mapped_vector, CopyOnWriteKeepsFile) {
+  std::string path = TempPath("s21_mapped_private");
+  {
+    s21::mapped_vector<int, s21::map_mode::read_write> numbers(path);
+    for (int i = 0; i < 100; ++i) numbers.push_back(i);
+  }
+  {
+    s21::mapped_vector<int, s21::map_mode::copy_on_write> numbers(path);
+    numbers[0] = 42;
+    EXPECT_EQ(numbers[0], 42);
+  }
+  s21::mapped_vector<int> numbers(path);
+  EXPECT_EQ(numbers[0], 0);
+  EXPECT_EQ(numbers[99], 99);
+  ::unlink(path.c_str());
+}
+
+TEST(mapped_vector, SharedBetweenMappings) {
+  std::string path = TempPath("s21_mapped_shared");
+  s21::mapped_vector<int, s21::map_mode::read_write> writer(path);
+  writer.resize(1000);
+  EXPECT_EQ(writer[999], 0);
+  s21::mapped_vector<int> reader(path);
+  writer[10] = 7;
+  writer.flush();
+  EXPECT_EQ(reader[10], 7);
+  ::unlink(path.c_str());
+}
+
+TEST(mapped_vector, ResizeAndMove) {
+  std::string path = TempPath("s21_mapped_resize");
+  s21::mapped_vector<long, s21::map_mode::read_write> numbers(path);
+  numbers.reserve(100000);
+  EXPECT_EQ(numbers.capacity(), 100000U);
+  for (long i = 0; i < 10; ++i) numbers.push_back(i);
+  numbers.pop_back();
+  numbers.resize(20);
+  EXPECT_EQ(numbers[9], 0);
+  EXPECT_EQ(numbers[8], 8);
+  numbers.shrink_to_fit();
+  EXPECT_EQ(numbers.capacity(), 20U);
+
+  s21::mapped_vector<long, s21::map_mode::read_write> moved(
+      std::move(numbers));
+  EXPECT_FALSE(numbers.is_open());
+  EXPECT_EQ(moved.size(), 20U);
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  moved.close();
+  EXPECT_FALSE(moved.is_open());
+
+  s21::mapped_vector<long> reopened(path);
+  EXPECT_TRUE(reopened.empty());
+  ::unlink(path.c_str());
+}
+
+TEST(mapped_vector, PartialElementIsRejected) {
+  std::string path = TempPath("s21_mapped_partial");
+  {
+    s21::mapped_vector<char, s21::map_mode::read_write> bytes(path);
+    for (char c = 0; c < 10; ++c) bytes.push_back(c);
+  }
+  using Numbers = s21::mapped_vector<int, s21::map_mode::read_write>;
+  EXPECT_THROW(Numbers{path}, std::runtime_error);
+  struct stat info;
+  ASSERT_EQ(::stat(path.c_str(), &info), 0);
+  EXPECT_EQ(info.st_size, 10);
+  ::unlink(path.c_str());
+}
+
+TEST(mapped_vector, MissingFile) {
+  EXPECT_THROW(s21::mapped_vector<int>(TempPath("s21_mapped_missing")),
+               std::system_error);
+}
@@ -0,0 +1,155 @@
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <string>
+
+#include "test_entry.h"
+
+namespace {
+s21::vector<int> RandomInts(size_t size, int range) {
+  std::mt19937 engine(42);
+  std::uniform_int_distribution<int> distribution(-range, range);
+  s21::vector<int> values;
+  values.reserve(size);
+  for (size_t i = 0; i < size; ++i) values.push_back(distribution(engine));
+  return values;
+}
+}  // namespace
+
+TEST(thread_pool, TaskGroupRunsEveryTask) {
+  s21::thread_pool pool(3);
+  EXPECT_EQ(pool.size(), 3U);
+  std::atomic<int> sum{0};
+  s21::task_group group(pool);
+  for (int i = 1; i <= 100; ++i) group.run([&sum, i] { sum += i; });
+  group.wait();
+  EXPECT_EQ(sum.load(), 5050);
+
+  s21::thread_pool inline_pool(0);
+  EXPECT_EQ(inline_pool.size(), 0U);
+  s21::task_group inline_group(inline_pool);
+  for (int i = 1; i <= 10; ++i) inline_group.run([&sum, i] { sum -= i; });
+  inline_group.wait();
+  EXPECT_EQ(sum.load(), 5050 - 55);
+}
+
+TEST(thread_pool, TaskGroupRethrows) {
+  s21::thread_pool pool(2);
+  s21::task_group group(pool);
+  std::atomic<int> done{0};
+  for (int i = 0; i < 10; ++i) {
+    group.run([&done, i] {
+      if (i == 5) throw std::runtime_error("task failed");
+      ++done;
+    });
+  }
+  EXPECT_THROW(group.wait(), std::runtime_error);
+  EXPECT_EQ(done.load(), 9);
+  group.run([&done] { ++done; });
+  EXPECT_NO_THROW(group.wait());
+}
+
+TEST(thread_pool, NestedGroupsDoNotDeadlock) {
+  s21::thread_pool pool(1);
+  std::atomic<int> leaves{0};
+  s21::task_group outer(pool);
+  for (int i = 0; i < 4; ++i) {
+    outer.run([&pool, &leaves] {
+      s21::task_group inner(pool);
+      for (int j = 0; j < 4; ++j) inner.run([&leaves] { ++leaves; });
+      inner.wait();
+    });
+  }
+  outer.wait();
+  EXPECT_EQ(leaves.load(), 16);
+}
+
+TEST(parallel, SortMatchesStdSort) {
+  s21::thread_pool pool(3);
+  for (size_t size : {0UL, 1UL, 1000UL, 100000UL, 300001UL}) {
+    s21::vector<int> values = RandomInts(size, 1000);
+    std::vector<int> expected(values.begin(), values.end());
+    std::sort(expected.begin(), expected.end());
+    s21::parallel::sort(pool, values.begin(), values.end());
+    ASSERT_EQ(values.size(), expected.size());
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), expected.begin()));
+  }
+}
+
+TEST(parallel, SortWithComparatorAndStrings) {
+  s21::vector<std::string> words;
+  for (int i = 0; i < 50000; ++i) {
+    words.push_back(std::to_string(i * 7919 % 50000));
+  }
+  std::vector<std::string> expected(words.begin(), words.end());
+  std::sort(expected.begin(), expected.end(), std::greater<>());
+  s21::thread_pool pool(4);
+  s21::parallel::sort(pool, words.begin(), words.end(), std::greater<>());
+  EXPECT_TRUE(std::equal(words.begin(), words.end(), expected.begin()));
+
+  s21::array<int, 5> small = {5, 1, 4, 2, 3};
+  s21::parallel::sort(small.begin(), small.end());
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(small[i], i + 1);
+}
+
+TEST(parallel, TransformAndForEach) {
+  s21::thread_pool pool(3);
+  s21::vector<int> values = RandomInts(100000, 100);
+  s21::vector<long> squares(values.size());
+  auto square = [](int value) { return long(value) * value; };
+  auto end = s21::parallel::transform(pool, values.begin(), values.end(),
+                                      squares.begin(), square);
+  EXPECT_EQ(end, squares.end());
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(squares[i], long(values[i]) * values[i]);
+  }
+  s21::parallel::for_each(pool, values.begin(), values.end(),
+                          [](int &value) { value = -value; });
+  EXPECT_EQ(squares[7], long(values[7]) * values[7]);
+  EXPECT_THROW(s21::parallel::for_each(pool, values.begin(), values.end(),
+                                       [](int value) {
+                                         if (value == 0) {
+                                           throw std::out_of_range("zero");
+                                         }
+                                       }),
+               std::out_of_range);
+}
+
+TEST(parallel, Reduce) {
+  s21::thread_pool pool(3);
+  s21::vector<int> values = RandomInts(200000, 1000);
+  long long expected = std::accumulate(values.begin(), values.end(), 10LL);
+  EXPECT_EQ(s21::parallel::reduce(pool, values.begin(), values.end(), 10LL),
+            expected);
+  // Concatenation is associative but not commutative.
+  s21::vector<std::string> letters;
+  for (int i = 0; i < 30000; ++i) {
+    letters.push_back(std::string(1, char('a' + i % 26)));
+  }
+  std::string joined = s21::parallel::reduce(pool, letters.begin(),
+                                             letters.end(), std::string(">"));
+  EXPECT_EQ(joined, std::accumulate(letters.begin(), letters.end(),
+                                    std::string(">")));
+  EXPECT_EQ(s21::parallel::reduce(values.begin(), values.begin(), 3), 3);
+}
+
+TEST(parallel, Scans) {
+  s21::thread_pool pool(3);
+  s21::vector<int> values = RandomInts(100003, 50);
+  s21::vector<long long> inclusive(values.size()), exclusive(values.size());
+  std::vector<long long> expected(values.size());
+  s21::parallel::inclusive_scan(pool, values.begin(), values.end(),
+                                inclusive.begin());
+  std::inclusive_scan(values.begin(), values.end(), expected.begin());
+  EXPECT_TRUE(std::equal(inclusive.begin(), inclusive.end(), expected.begin()));
+  s21::parallel::exclusive_scan(pool, values.begin(), values.end(),
+                                exclusive.begin(), 5LL);
+  std::exclusive_scan(values.begin(), values.end(), expected.begin(), 5LL);
+  EXPECT_TRUE(std::equal(exclusive.begin(), exclusive.end(), expected.begin()));
+
+  // In place, with the default pool.
+  s21::vector<int> ones(50000);
+  std::fill(ones.begin(), ones.end(), 1);
+  s21::parallel::inclusive_scan(ones.begin(), ones.end(), ones.begin());
+  for (int i = 0; i < 50000; ++i) ASSERT_EQ(ones[i], i + 1);
+}
@@ -0,0 +1,110 @@
+#include "test_entry.h"
+
+namespace {
+// Upstream resource that counts the blocks it hands out.
+class CountingResource : public s21::pmr::memory_resource {
+ public:
+  int allocations = 0;
+  int live = 0;
+
+ private:
+  void *do_allocate(size_t bytes, size_t alignment) override {
+    ++allocations;
+    ++live;
+    return s21::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *p, size_t bytes, size_t alignment) override {
+    --live;
+    s21::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(
+      const s21::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+}  // namespace
+
+TEST(pmr, MonotonicBufferAlignment) {
+  s21::pmr::monotonic_buffer_resource arena(64);
+  for (size_t alignment = 1; alignment <= 64; alignment *= 2) {
+    void *p = arena.allocate(3, alignment);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % alignment, 0U);
+  }
+  void *large = arena.allocate(10000, 16);
+  EXPECT_NE(large, nullptr);
+}
+
+TEST(pmr, MonotonicBufferTooLarge) {
+  CountingResource upstream;
+  s21::pmr::monotonic_buffer_resource arena(64, &upstream);
+  EXPECT_THROW(arena.allocate(std::numeric_limits<size_t>::max() - 8, 16),
+               std::bad_alloc);
+  EXPECT_EQ(upstream.allocations, 0);
+  EXPECT_NE(arena.allocate(32, 16), nullptr);
+}
+
+TEST(pmr, MonotonicBufferRelease) {
+  CountingResource upstream;
+  {
+    s21::pmr::monotonic_buffer_resource arena(256, &upstream);
+    for (int i = 0; i < 100; ++i) arena.allocate(64);
+    EXPECT_GT(upstream.allocations, 1);
+    EXPECT_LT(upstream.allocations, 10);
+    arena.release();
+    EXPECT_EQ(upstream.live, 0);
+    arena.allocate(64);
+    EXPECT_EQ(upstream.live, 1);
+  }
+  EXPECT_EQ(upstream.live, 0);
+}
+
+TEST(pmr, InitialBuffer) {
+  CountingResource upstream;
+  alignas(std::max_align_t) unsigned char buffer[512];
+  s21::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), &upstream);
+  void *p = arena.allocate(100);
+  EXPECT_GE(static_cast<unsigned char *>(p), buffer);
+  EXPECT_LT(static_cast<unsigned char *>(p), buffer + sizeof(buffer));
+  EXPECT_EQ(upstream.allocations, 0);
+  arena.allocate(1000);
+  EXPECT_EQ(upstream.allocations, 1);
+  arena.release();
+  EXPECT_EQ(arena.allocate(8), static_cast<void *>(buffer));
+}
+
+TEST(pmr, VectorInArena) {
+  CountingResource upstream;
+  s21::pmr::monotonic_buffer_resource arena(1 << 18, &upstream);
+  {
+    s21::pmr::vector<int> numbers(&arena);
+    s21::pmr::vector<std::string> words(&arena);
+    for (int i = 0; i < 1000; ++i) {
+      numbers.push_back(i);
+      words.emplace_back(3, 'a' + i % 26);
+    }
+    EXPECT_EQ(numbers[999], 999);
+    EXPECT_EQ(words[27], "bbb");
+    EXPECT_EQ(numbers.get_allocator().resource(), &arena);
+  }
+  EXPECT_EQ(upstream.allocations, 1);
+}
+
+TEST(pmr, VectorKeepsResource) {
+  s21::pmr::monotonic_buffer_resource first_arena;
+  s21::pmr::monotonic_buffer_resource second_arena;
+  s21::pmr::vector<std::string> first({"a", "b", "c"}, &first_arena);
+  s21::pmr::vector<std::string> second(&second_arena);
+
+  second = first;
+  EXPECT_EQ(second.get_allocator().resource(), &second_arena);
+  EXPECT_EQ(second[2], "c");
+
+  second = std::move(first);
+  EXPECT_EQ(second.get_allocator().resource(), &second_arena);
+  EXPECT_EQ(second.size(), 3U);
+
+  s21::pmr::vector<std::string> copy(second);
+  EXPECT_EQ(copy.get_allocator().resource(),
+            s21::pmr::new_delete_resource());
+  EXPECT_EQ(copy[0], "a");
+}
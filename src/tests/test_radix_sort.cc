@@ -0,0 +1,115 @@
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+
+#include "test_entry.h"
+
+namespace {
+template <typename T>
+s21::vector<T> RandomValues(size_t size, T low, T high) {
+  std::mt19937_64 engine(7);
+  s21::vector<T> values;
+  values.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    if constexpr (std::is_floating_point_v<T>) {
+      values.push_back(std::uniform_real_distribution<T>(low, high)(engine));
+    } else {
+      values.push_back(std::uniform_int_distribution<T>(low, high)(engine));
+    }
+  }
+  return values;
+}
+
+template <typename T>
+void ExpectSortedLikeStd(s21::vector<T> values) {
+  std::vector<T> expected(values.begin(), values.end());
+  std::sort(expected.begin(), expected.end());
+  s21::radix_sort(values.begin(), values.end());
+  ASSERT_EQ(values.size(), expected.size());
+  EXPECT_TRUE(std::equal(values.begin(), values.end(), expected.begin()));
+}
+
+struct Record {
+  uint32_t key;
+  std::string name;
+};
+}  // namespace
+
+TEST(radix_sort, Integers) {
+  ExpectSortedLikeStd(RandomValues<uint64_t>(
+      100000, 0, std::numeric_limits<uint64_t>::max()));
+  ExpectSortedLikeStd(RandomValues<int32_t>(100000, -1000000, 1000000));
+  ExpectSortedLikeStd(RandomValues<int16_t>(5000, -300, 300));
+  ExpectSortedLikeStd(RandomValues<int64_t>(
+      200, std::numeric_limits<int64_t>::min(),
+      std::numeric_limits<int64_t>::max()));
+  // Only the lowest digit differs, so every other pass is skipped.
+  ExpectSortedLikeStd(RandomValues<uint32_t>(10000, 1000, 1200));
+  ExpectSortedLikeStd(s21::vector<uint8_t>());
+}
+
+TEST(radix_sort, FloatingPoint) {
+  ExpectSortedLikeStd(RandomValues<double>(50000, -1e9, 1e9));
+  s21::vector<float> values = RandomValues<float>(3000, -1.0f, 1.0f);
+  values.push_back(-std::numeric_limits<float>::infinity());
+  values.push_back(std::numeric_limits<float>::infinity());
+  values.push_back(std::numeric_limits<float>::lowest());
+  ExpectSortedLikeStd(values);
+}
+
+TEST(radix_sort, RecordsByKeyAreStable) {
+  s21::vector<Record> records;
+  for (uint32_t i = 0; i < 20000; ++i) {
+    records.push_back(Record{(i * 2654435761U) % 1000, std::to_string(i)});
+  }
+  auto key = [](const Record &record) { return record.key; };
+  s21::vector<Record> scratch;
+  s21::radix_sort(records.begin(), records.end(), scratch, key);
+  EXPECT_EQ(scratch.size(), records.size());
+  for (size_t i = 1; i < records.size(); ++i) {
+    ASSERT_LE(records[i - 1].key, records[i].key);
+    if (records[i - 1].key == records[i].key) {
+      ASSERT_LT(std::stoul(records[i - 1].name), std::stoul(records[i].name));
+    }
+  }
+  // A second sort reuses the scratch vector.
+  const Record *storage = scratch.begin();
+  auto descending = [](const Record &record) { return -int(record.key); };
+  s21::radix_sort(records.begin(), records.end(), scratch, descending);
+  EXPECT_EQ(scratch.begin(), storage);
+  EXPECT_EQ(records.front().key, 999U);
+  EXPECT_EQ(records.back().key, 0U);
+}
+
+TEST(radix_sort, ParallelMatchesStableSort) {
+  s21::thread_pool pool(3);
+  s21::vector<int64_t> values = RandomValues<int64_t>(200001, -50000, 50000);
+  std::vector<int64_t> expected(values.begin(), values.end());
+  std::stable_sort(expected.begin(), expected.end());
+  s21::radix_sort(pool, values.begin(), values.end());
+  EXPECT_TRUE(std::equal(values.begin(), values.end(), expected.begin()));
+
+  s21::vector<Record> records;
+  for (uint32_t i = 0; i < 50000; ++i) {
+    records.push_back(Record{(i * 7919U) % 300, std::to_string(i)});
+  }
+  std::vector<Record> expected_records(records.begin(), records.end());
+  auto key = [](const Record &record) { return record.key; };
+  std::stable_sort(expected_records.begin(), expected_records.end(),
+                   [&key](const Record &a, const Record &b) {
+                     return key(a) < key(b);
+                   });
+  s21::vector<Record> scratch;
+  s21::radix_sort(pool, records.begin(), records.end(), scratch, key);
+  ASSERT_EQ(records.size(), expected_records.size());
+  for (size_t i = 0; i < records.size(); ++i) {
+    ASSERT_EQ(records[i].key, expected_records[i].key);
+    ASSERT_EQ(records[i].name, expected_records[i].name);
+  }
+
+  s21::array<uint16_t, 4> small = {300, 2, 65535, 0};
+  s21::radix_sort(pool, small.begin(), small.end());
+  EXPECT_EQ(small[0], 0);
+  EXPECT_EQ(small[3], 65535);
+}
@@ -0,0 +1,74 @@
+#include "test_entry.h"
+
+TEST(segmented_vector, StableAddresses) {
+  s21::segmented_vector<int, 16> vector;
+  vector.push_back(0);
+  int *first = &vector[0];
+  for (int i = 1; i < 1000; ++i) vector.push_back(i);
+  EXPECT_EQ(first, &vector[0]);
+  EXPECT_EQ(*first, 0);
+  EXPECT_EQ(vector.size(), 1000U);
+  EXPECT_EQ(vector.chunk_count(), 63U);
+  EXPECT_EQ(vector.capacity(), 1008U);
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(vector[i], i);
+  EXPECT_EQ(vector.back(), 999);
+  EXPECT_ANY_THROW(vector.at(1000));
+}
+
+TEST(segmented_vector, EmplaceFromOwnElement) {
+  s21::segmented_vector<std::string, 4> words = {"a", "b", "c", "d"};
+  EXPECT_EQ(words.capacity(), 4U);
+  std::string &last = words.emplace_back(words[1]);
+  EXPECT_EQ(last, "b");
+  EXPECT_EQ(words.chunk_count(), 2U);
+  words.push_back(std::string(50, 'x'));
+  EXPECT_EQ(words[5].size(), 50U);
+  words.pop_back();
+  words.pop_back();
+  EXPECT_EQ(words.size(), 4U);
+  words.shrink_to_fit();
+  EXPECT_EQ(words.chunk_count(), 1U);
+  EXPECT_EQ(words.front(), "a");
+}
+
+TEST(segmented_vector, Iterators) {
+  s21::segmented_vector<int, 8> vector;
+  for (int i = 100; i > 0; --i) vector.push_back(i);
+  std::sort(vector.begin(), vector.end());
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(vector[i], i + 1);
+  EXPECT_EQ(vector.end() - vector.begin(), 100);
+  EXPECT_EQ(*(vector.begin() + 50), 51);
+  const auto &view = vector;
+  auto it = std::find(view.begin(), view.end(), 42);
+  EXPECT_EQ(it - view.begin(), 41);
+  int total = 0;
+  for (int value : vector) total += value;
+  EXPECT_EQ(total, 5050);
+}
+
+TEST(segmented_vector, CopyMoveAndResize) {
+  s21::segmented_vector<std::string, 2> words = {"a", "b", "c"};
+  s21::segmented_vector<std::string, 2> copy(words);
+  copy[0] = "changed";
+  EXPECT_EQ(words[0], "a");
+  s21::segmented_vector<std::string, 2> moved(std::move(copy));
+  EXPECT_EQ(moved[0], "changed");
+  EXPECT_TRUE(copy.empty());
+  copy = words;
+  EXPECT_EQ(copy.size(), 3U);
+  words = std::move(moved);
+  EXPECT_EQ(words[0], "changed");
+
+  words.resize(7);
+  EXPECT_EQ(words.size(), 7U);
+  EXPECT_EQ(words[6], "");
+  words.resize(1);
+  EXPECT_EQ(words.size(), 1U);
+  EXPECT_EQ(words.capacity(), 8U);
+  words.clear();
+  EXPECT_TRUE(words.empty());
+
+  s21::segmented_vector<double> sized(5000);
+  EXPECT_EQ(sized[4999], 0.0);
+  EXPECT_EQ(s21::segmented_vector<double>::kChunkSize, 512U);
+}
@@ -0,0 +1,126 @@
+#include "test_entry.h"
+
+namespace {
+const s21::simd::level kLevels[] = {
+    s21::simd::level::scalar, s21::simd::level::v128, s21::simd::level::v256,
+    s21::simd::level::v512};
+
+// Runs check once on every level this CPU supports and restores the
+// default afterwards.
+template <typename Check>
+void OnEveryLevel(Check check) {
+  for (s21::simd::level level : kLevels) {
+    if (level > s21::simd::supported_level()) break;
+    s21::simd::set_level(level);
+    check();
+  }
+  s21::simd::set_level(s21::simd::supported_level());
+}
+}  // namespace
+
+TEST(simd, Levels) {
+  s21::simd::set_level(s21::simd::level::scalar);
+  EXPECT_EQ(s21::simd::active_level(), s21::simd::level::scalar);
+  s21::simd::set_level(s21::simd::level::v512);
+  EXPECT_EQ(s21::simd::active_level(), s21::simd::supported_level());
+}
+
+TEST(simd, Find) {
+  s21::vector<int> vector;
+  for (int i = 0; i < 1000; ++i) vector.push_back(i % 251);
+  OnEveryLevel([&] {
+    EXPECT_EQ(s21::simd::find(vector, 0), vector.begin());
+    EXPECT_EQ(s21::simd::find(vector, 250) - vector.begin(), 250);
+    EXPECT_EQ(s21::simd::find(vector, 1000), vector.end());
+    EXPECT_EQ(s21::simd::find(vector.data() + 251, vector.data() + 260, 3),
+              vector.data() + 254);
+  });
+
+  s21::vector<float> floats = {1.5f, 2.5f, -0.0f, 4.5f};
+  EXPECT_EQ(s21::simd::find(floats, 0.0f) - floats.begin(), 2);
+  s21::vector<std::string> words = {"a", "b", "c"};
+  EXPECT_EQ(s21::simd::find(words, "c") - words.begin(), 2);
+}
+
+TEST(simd, Count) {
+  s21::vector<char> chars;
+  for (int i = 0; i < 100000; ++i) chars.push_back(i % 5 == 0 ? 'x' : 'y');
+  s21::vector<double> doubles;
+  for (int i = 0; i < 1001; ++i) doubles.push_back(i % 2 == 0 ? 0.5 : 1.5);
+  OnEveryLevel([&] {
+    EXPECT_EQ(s21::simd::count(chars, 'x'), 20000U);
+    EXPECT_EQ(s21::simd::count(chars, 'z'), 0U);
+    EXPECT_EQ(s21::simd::count(doubles, 0.5), 501U);
+  });
+}
+
+TEST(simd, MinMax) {
+  s21::vector<short> values;
+  for (int i = 0; i < 777; ++i) values.push_back(short((i * 37) % 1000 - 500));
+  auto std_min = std::min_element(values.begin(), values.end());
+  auto std_max = std::max_element(values.begin(), values.end());
+  s21::vector<unsigned> empty;
+  OnEveryLevel([&] {
+    EXPECT_EQ(s21::simd::min_element(values), std_min);
+    EXPECT_EQ(s21::simd::max_element(values), std_max);
+    EXPECT_EQ(s21::simd::min_element(empty), empty.end());
+  });
+
+  s21::vector<double> doubles = {3.0, -1.0, 7.0, -1.0, 7.0, 2.0, 0.0};
+  EXPECT_EQ(s21::simd::min_element(doubles) - doubles.begin(), 1);
+  EXPECT_EQ(s21::simd::max_element(doubles) - doubles.begin(), 2);
+}
+
+TEST(simd, Sum) {
+  s21::vector<int> ints;
+  for (int i = 1; i <= 1000; ++i) ints.push_back(i);
+  s21::vector<unsigned char> bytes(300);
+  s21::simd::fill(bytes, 1);
+  s21::vector<float> floats;
+  for (int i = 0; i < 1000; ++i) floats.push_back(0.25f);
+  OnEveryLevel([&] {
+    EXPECT_EQ(s21::simd::sum(ints), 500500);
+    EXPECT_EQ(s21::simd::sum(bytes), 300 % 256);
+    EXPECT_FLOAT_EQ(s21::simd::sum(floats), 250.0f);
+  });
+}
+
+TEST(simd, Fill) {
+  OnEveryLevel([] {
+    s21::vector<long long> vector(123);
+    s21::simd::fill(vector, -7);
+    for (long long value : vector) EXPECT_EQ(value, -7);
+    s21::simd::fill(vector.data() + 10, vector.data() + 20, 3);
+    EXPECT_EQ(vector[9], -7);
+    EXPECT_EQ(vector[10], 3);
+    EXPECT_EQ(vector[20], -7);
+
+    s21::array<float, 37> array;
+    array.fill(1.5f);
+    for (float value : array) EXPECT_EQ(value, 1.5f);
+  });
+}
+
+TEST(simd, Equal) {
+  s21::vector<int> a, b;
+  for (int i = 0; i < 500; ++i) {
+    a.push_back(i);
+    b.push_back(i);
+  }
+  s21::vector<double> nan = {std::numeric_limits<double>::quiet_NaN()};
+  OnEveryLevel([&] {
+    EXPECT_TRUE(s21::simd::equal(a, b));
+    b[421] = -1;
+    EXPECT_FALSE(s21::simd::equal(a, b));
+    b[421] = 421;
+    b.pop_back();
+    EXPECT_FALSE(s21::simd::equal(a, b));
+    b.push_back(499);
+    EXPECT_FALSE(s21::simd::equal(nan, nan));
+  });
+}
+
+TEST(simd, SizedVectorIsZeroed) {
+  s21::vector<double> vector(1000);
+  for (double value : vector) EXPECT_EQ(value, 0.0);
+}
@@ -0,0 +1,137 @@
+#include "test_entry.h"
+
+TEST(small_vector, StaysInline) {
+  s21::small_vector<int, 8> vector;
+  for (int i = 0; i < 8; ++i) vector.push_back(i);
+  EXPECT_TRUE(vector.is_inline());
+  EXPECT_EQ(vector.capacity(), 8U);
+  EXPECT_EQ(vector.size(), 8U);
+  EXPECT_EQ(vector.back(), 7);
+  vector.push_back(8);
+  EXPECT_FALSE(vector.is_inline());
+  EXPECT_EQ(vector.capacity(), 16U);
+  for (int i = 0; i < 9; ++i) EXPECT_EQ(vector[i], i);
+}
+
+TEST(small_vector, Constructors) {
+  s21::small_vector<std::string, 2> empty;
+  EXPECT_TRUE(empty.empty());
+  s21::small_vector<std::string, 2> sized(3);
+  EXPECT_EQ(sized.size(), 3U);
+  EXPECT_EQ(sized[2], "");
+  s21::small_vector<std::string, 2> items = {"a", "b", "c"};
+  EXPECT_EQ(items.at(2), "c");
+  EXPECT_ANY_THROW(items.at(3));
+  std::list<std::string> source = {"x", "y"};
+  s21::small_vector<std::string, 2> range(source.begin(), source.end());
+  EXPECT_TRUE(range.is_inline());
+  EXPECT_EQ(range.front(), "x");
+  s21::small_vector<std::string, 2> copy(items);
+  EXPECT_EQ(copy.size(), 3U);
+  EXPECT_EQ(copy[1], "b");
+}
+
+TEST(small_vector, MoveHeapBuffer) {
+  s21::small_vector<std::string, 2> vector = {"a", "b", "c", "d"};
+  const std::string *buffer = vector.data();
+  s21::small_vector<std::string, 2> moved(std::move(vector));
+  EXPECT_EQ(moved.data(), buffer);
+  EXPECT_TRUE(vector.empty());
+  EXPECT_TRUE(vector.is_inline());
+  vector.push_back("e");
+  EXPECT_EQ(vector[0], "e");
+
+  s21::small_vector<std::string, 2> assigned;
+  assigned = std::move(moved);
+  EXPECT_EQ(assigned.data(), buffer);
+  EXPECT_EQ(assigned[3], "d");
+}
+
+TEST(small_vector, MoveInline) {
+  s21::small_vector<std::unique_ptr<int>, 4> vector;
+  vector.push_back(std::make_unique<int>(1));
+  vector.emplace_back(new int(2));
+  s21::small_vector<std::unique_ptr<int>, 4> moved(std::move(vector));
+  EXPECT_TRUE(moved.is_inline());
+  EXPECT_EQ(*moved[1], 2);
+  EXPECT_TRUE(vector.empty());
+}
+
+TEST(small_vector, Insert) {
+  s21::small_vector<std::string, 4> vector = {"a", "e"};
+  std::vector<std::string> expected = {"a", "e"};
+  std::list<std::string> source = {"b", "c", "d"};
+  vector.insert(vector.begin() + 1, source.begin(), source.end());
+  expected.insert(expected.begin() + 1, source.begin(), source.end());
+  vector.insert(vector.begin(), 2, "z");
+  expected.insert(expected.begin(), 2, "z");
+  vector.insert(vector.end(), vector[0]);
+  expected.insert(expected.end(), expected[0]);
+  vector.emplace(vector.begin() + 3, 3, 'q');
+  expected.emplace(expected.begin() + 3, 3, 'q');
+  vector.insert_many(vector.begin() + 1, "m", "n");
+  expected.insert(expected.begin() + 1, {"m", "n"});
+  vector.insert_many_back("last");
+  expected.push_back("last");
+  ASSERT_EQ(vector.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(vector[i], expected[i]);
+  EXPECT_ANY_THROW(vector.insert(vector.end() + 1, "x"));
+}
+
+TEST(small_vector, InsertManyOwnElements) {
+  std::string long_string(40, 'a');
+  s21::small_vector<std::string, 1> vector = {long_string};
+  vector.insert_many_back(vector[0]);
+  vector.insert_many(vector.begin(), vector[1]);
+  ASSERT_EQ(vector.size(), 3U);
+  for (const std::string &value : vector) EXPECT_EQ(value, long_string);
+  vector.back() = "z";
+  vector.insert_many(vector.begin() + 1, vector.back(), vector.front());
+  ASSERT_EQ(vector.size(), 5U);
+  EXPECT_EQ(vector[1], "z");
+  EXPECT_EQ(vector[2], long_string);
+}
+
+TEST(small_vector, EraseAndPop) {
+  s21::small_vector<int, 4> vector = {1, 2, 3, 4, 5};
+  auto it = vector.erase(vector.begin() + 1);
+  EXPECT_EQ(*it, 3);
+  vector.pop_back();
+  EXPECT_EQ(vector.size(), 3U);
+  EXPECT_EQ(vector.back(), 4);
+  vector.shrink_to_fit();
+  EXPECT_TRUE(vector.is_inline());
+  EXPECT_EQ(vector.capacity(), 4U);
+  EXPECT_EQ(vector[0], 1);
+  EXPECT_EQ(vector[2], 4);
+  EXPECT_ANY_THROW(vector.erase(vector.end()));
+  vector.clear();
+  EXPECT_TRUE(vector.empty());
+}
+
+TEST(small_vector, Swap) {
+  s21::small_vector<std::string, 2> inline_vector = {"a"};
+  s21::small_vector<std::string, 2> heap_vector = {"b", "c", "d"};
+  inline_vector.swap(heap_vector);
+  EXPECT_EQ(inline_vector.size(), 3U);
+  EXPECT_EQ(inline_vector[2], "d");
+  EXPECT_EQ(heap_vector.size(), 1U);
+  EXPECT_EQ(heap_vector[0], "a");
+  EXPECT_TRUE(heap_vector.is_inline());
+}
+
+TEST(small_vector, AssignAndAppend) {
+  s21::small_vector<int, 4> vector = {1, 2, 3, 4, 5, 6};
+  vector = {7, 8};
+  EXPECT_EQ(vector.size(), 2U);
+  EXPECT_EQ(vector[1], 8);
+  std::vector<int> chunk = {9, 10};
+  vector.append_range(chunk);
+  EXPECT_EQ(vector.size(), 4U);
+  EXPECT_EQ(vector.back(), 10);
+  s21::small_vector<int, 4> copy;
+  copy = vector;
+  EXPECT_EQ(copy.size(), 4U);
+  EXPECT_EQ(copy[2], 9);
+}
@@ -0,0 +1,139 @@
+#include "test_entry.h"
+
+namespace {
+using Records = s21::soa_vector<int, long long, double, unsigned char>;
+
+// Its constructors throw once budget constructions have run.
+struct ThrowingField {
+  static int budget;
+  std::string name = std::string(40, 'x');
+  ThrowingField() { Count(); }
+  ThrowingField(const ThrowingField &other) : name(other.name) { Count(); }
+  static void Count() {
+    if (budget-- <= 0) throw std::runtime_error("Field");
+  }
+};
+int ThrowingField::budget = 0;
+}  // namespace
+
+TEST(soa_vector, PushBackAndRows) {
+  Records records;
+  for (int i = 0; i < 1000; ++i) {
+    records.push_back(std::make_tuple(i, i * 1000LL, i * 0.5,
+                                      static_cast<unsigned char>(i & 7)));
+  }
+  EXPECT_EQ(records.size(), 1000U);
+  EXPECT_GE(records.capacity(), 1000U);
+  Records::value_type record = records[10];
+  EXPECT_EQ(record, std::make_tuple(10, 10000LL, 5.0, (unsigned char)2));
+  EXPECT_EQ(records.back().get<0>(), 999);
+  EXPECT_EQ(records.front().get<1>(), 0);
+  EXPECT_ANY_THROW(records.at(1000));
+
+  auto [id, timestamp, value, flags] = records[20];
+  EXPECT_EQ(id, 20);
+  EXPECT_EQ(timestamp, 20000);
+  value = -1.0;
+  flags = 0xFF;
+  EXPECT_EQ(records[20].get<2>(), -1.0);
+  EXPECT_EQ(records.column<3>()[20], 0xFF);
+}
+
+TEST(soa_vector, EmplaceBackAndAssign) {
+  s21::soa_vector<std::string, int> words;
+  auto row = words.emplace_back("alpha", 1);
+  EXPECT_EQ(row.get<0>(), "alpha");
+  words.emplace_back(std::string(100, 'x'), 2);
+  words.push_back({"gamma", 3});
+  words[0] = words[2];
+  EXPECT_EQ(words[0].get<0>(), "gamma");
+  EXPECT_EQ(words[0].get<1>(), 3);
+  words[1] = std::make_tuple(std::string("beta"), 20);
+  EXPECT_EQ(words.column<1>()[1], 20);
+
+  // The new record may refer to one that moves when the columns grow.
+  words.shrink_to_fit();
+  EXPECT_EQ(words.capacity(), words.size());
+  words.emplace_back(words.column<0>()[1], words.column<1>()[1]);
+  EXPECT_EQ(words.back().get<0>(), "beta");
+  EXPECT_EQ(words.size(), 4U);
+
+  words.pop_back();
+  EXPECT_EQ(words.size(), 3U);
+  words.clear();
+  EXPECT_TRUE(words.empty());
+}
+
+TEST(soa_vector, Columns) {
+  Records records;
+  for (int i = 0; i < 500; ++i) {
+    records.emplace_back(i, 7LL, 1.5, static_cast<unsigned char>(i % 3));
+  }
+  auto ids = records.column<0>();
+  EXPECT_EQ(ids.size(), 500U);
+  EXPECT_EQ(ids.data(), records.data<0>());
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(records.data<1>()) %
+                Records::kColumnAlignment,
+            0U);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(records.data<3>()) %
+                Records::kColumnAlignment,
+            0U);
+
+  EXPECT_EQ(s21::simd::sum(records.column<0>()), 124750);
+  EXPECT_EQ(s21::simd::count(records.column<3>(), 1), 167U);
+  EXPECT_EQ(*s21::simd::max_element(records.column<0>()), 499);
+  EXPECT_EQ(s21::simd::find(records.column<0>(), 42) - ids.begin(), 42);
+  s21::simd::fill(records.column<2>(), 2.0);
+  EXPECT_EQ(records[499].get<2>(), 2.0);
+
+  const Records &view = records;
+  s21::column_view<const long long> timestamps = view.column<1>();
+  long long total = 0;
+  for (long long timestamp : timestamps) total += timestamp;
+  EXPECT_EQ(total, 3500);
+  EXPECT_ANY_THROW(timestamps.at(500));
+}
+
+TEST(soa_vector, CopyMoveAndResize) {
+  s21::soa_vector<std::string, int> words = {{"a", 1}, {"b", 2}, {"c", 3}};
+  s21::soa_vector<std::string, int> copy(words);
+  copy[0].get<0>() = "changed";
+  EXPECT_EQ(words[0].get<0>(), "a");
+  s21::soa_vector<std::string, int> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 3U);
+  EXPECT_TRUE(copy.empty());
+  copy = moved;
+  EXPECT_EQ(copy[0].get<0>(), "changed");
+
+  words.resize(5);
+  EXPECT_EQ(words[4].get<0>(), "");
+  EXPECT_EQ(words[4].get<1>(), 0);
+  words.resize(2);
+  EXPECT_EQ(words.size(), 2U);
+
+  int total = 0;
+  std::string joined;
+  for (auto row : words) {
+    joined += row.get<0>();
+    total += row.get<1>();
+  }
+  EXPECT_EQ(joined, "ab");
+  EXPECT_EQ(total, 3);
+
+  s21::soa_vector<double, float> sized(10);
+  EXPECT_EQ(sized.size(), 10U);
+  EXPECT_EQ(sized[9].get<1>(), 0.0f);
+}
+
+TEST(soa_vector, ConstructorsReleaseColumnsOnThrow) {
+  using Rows = s21::soa_vector<int, ThrowingField>;
+  ThrowingField::budget = 2;
+  EXPECT_THROW(Rows(5), std::runtime_error);
+
+  ThrowingField::budget = 100;
+  std::initializer_list<Rows::value_type> items = {{1, ThrowingField()},
+                                                   {2, ThrowingField()}};
+  ThrowingField::budget = 1;
+  EXPECT_THROW(Rows{items}, std::runtime_error);
+  ThrowingField::budget = 100;
+}
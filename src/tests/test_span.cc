@@ -0,0 +1,171 @@
+#include <limits>
+#include <numeric>
+
+#include "test_entry.h"
+
+namespace {
+int Sum(s21::span<const int> values) {
+  int sum = 0;
+  for (int value : values) sum += value;
+  return sum;
+}
+}  // namespace
+
+TEST(span, FromContainersWithoutCopying) {
+  s21::vector<int> vector = {1, 2, 3, 4, 5};
+  s21::span<int> all(vector);
+  EXPECT_EQ(all.data(), vector.begin());
+  EXPECT_EQ(all.size(), 5U);
+  EXPECT_EQ(all.size_bytes(), 5 * sizeof(int));
+  all[0] = 10;
+  EXPECT_EQ(vector[0], 10);
+  EXPECT_EQ(Sum(vector), 24);
+  EXPECT_EQ(Sum(all), 24);
+
+  const s21::vector<int> &constant = vector;
+  s21::span deduced(constant);
+  static_assert(std::is_same_v<decltype(deduced), s21::span<const int>>);
+  EXPECT_EQ(deduced.back(), 5);
+
+  s21::array<int, 3> array = {7, 8, 9};
+  s21::span from_array(array);
+  EXPECT_EQ(from_array.front(), 7);
+  s21::small_vector<int, 4> small = {1, 1};
+  EXPECT_EQ(Sum(small), 2);
+  std::vector<int> standard = {4, 5};
+  EXPECT_EQ(Sum(standard), 9);
+  EXPECT_EQ(Sum({array.begin(), array.end()}), 24);
+
+  s21::span<int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_THROW(empty.front(), std::out_of_range);
+  EXPECT_THROW(empty.back(), std::out_of_range);
+}
+
+TEST(span, Slicing) {
+  s21::vector<int> vector = {0, 1, 2, 3, 4, 5, 6, 7};
+  s21::span<int> all(vector);
+  s21::span<int> middle = all.subspan(2, 4);
+  EXPECT_EQ(middle.size(), 4U);
+  EXPECT_EQ(middle.front(), 2);
+  EXPECT_EQ(middle.back(), 5);
+  EXPECT_EQ(all.subspan(6).size(), 2U);
+  EXPECT_EQ(all.subspan(8).size(), 0U);
+  EXPECT_EQ(all.first(3).back(), 2);
+  EXPECT_EQ(all.last(3).front(), 5);
+  EXPECT_THROW(all.subspan(9), std::out_of_range);
+  EXPECT_THROW(all.subspan(4, 5), std::out_of_range);
+  EXPECT_THROW(all.last(9), std::out_of_range);
+  EXPECT_THROW(middle.at(4), std::out_of_range);
+
+  std::sort(middle.rbegin(), middle.rend());
+  EXPECT_EQ(vector[2], 5);
+  EXPECT_EQ(vector[5], 2);
+  EXPECT_EQ(vector[6], 6);
+}
+
+TEST(span, WorksWithLibraryAlgorithms) {
+  s21::vector<int> vector(100000);
+  for (int i = 0; i < 100000; ++i) vector[i] = 100000 - i;
+  s21::span<int> tail = s21::span<int>(vector).subspan(50000);
+  EXPECT_EQ(s21::simd::sum(tail.first(4)), 50000 + 49999 + 49998 + 49997);
+  EXPECT_EQ(*s21::simd::min_element(tail), 1);
+  s21::radix_sort(tail.begin(), tail.end());
+  EXPECT_EQ(tail.front(), 1);
+  EXPECT_EQ(vector[49999], 50001);
+  s21::parallel::for_each(tail.begin(), tail.end(), [](int &v) { v = -v; });
+  EXPECT_EQ(vector.back(), -50000);
+}
+
+TEST(span, StridedView) {
+  // A 3x4 row-major matrix.
+  s21::array<int, 12> matrix = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  s21::span<int> cells(matrix);
+  s21::strided_view<int> column = cells.subspan(1).strided(4);
+  EXPECT_EQ(column.size(), 3U);
+  EXPECT_EQ(column[0], 1);
+  EXPECT_EQ(column[2], 9);
+  EXPECT_EQ(column.back(), 9);
+  EXPECT_THROW(column.at(3), std::out_of_range);
+  column[1] = 50;
+  EXPECT_EQ(matrix[5], 50);
+  EXPECT_EQ(column.end() - column.begin(), 3);
+
+  std::sort(column.begin(), column.end(), std::greater<>());
+  EXPECT_EQ(matrix[1], 50);
+  EXPECT_EQ(matrix[9], 1);
+  s21::strided_view<const int> evens = s21::span<const int>(cells).strided(2);
+  EXPECT_EQ(evens.size(), 6U);
+  EXPECT_EQ(std::accumulate(evens.begin(), evens.end(), 0), 30);
+  EXPECT_EQ(cells.strided(5).size(), 3U);
+  EXPECT_THROW(cells.strided(0), std::invalid_argument);
+  constexpr size_t kHuge = std::numeric_limits<size_t>::max();
+  EXPECT_EQ(cells.strided(kHuge).size(), 1U);
+  EXPECT_EQ(cells.strided(kHuge).front(), 0);
+  EXPECT_TRUE(cells.first(0).strided(kHuge).empty());
+}
+
+TEST(span, ChunkView) {
+  s21::vector<int> vector;
+  for (int i = 0; i < 10; ++i) vector.push_back(i);
+  s21::chunk_view<int> chunks = s21::span<int>(vector).chunks(4);
+  EXPECT_EQ(chunks.size(), 3U);
+  EXPECT_EQ(chunks.chunk_size(), 4U);
+  EXPECT_EQ(chunks[0].size(), 4U);
+  EXPECT_EQ(chunks[2].size(), 2U);
+  EXPECT_EQ(chunks.at(2).back(), 9);
+  EXPECT_THROW(chunks.at(3), std::out_of_range);
+  int expected_first = 0;
+  for (s21::span<int> chunk : chunks) {
+    EXPECT_EQ(chunk.front(), expected_first);
+    expected_first += 4;
+    chunk.front() = -1;
+  }
+  EXPECT_EQ(vector[4], -1);
+  EXPECT_EQ(chunks.end() - chunks.begin(), 3);
+  EXPECT_TRUE(s21::span<int>().chunks(3).empty());
+  EXPECT_EQ(s21::span<int>().chunks(3).size(), 0U);
+  EXPECT_THROW(s21::span<int>(vector).chunks(0), std::invalid_argument);
+  s21::chunk_view<int> whole =
+      s21::span<int>(vector).chunks(std::numeric_limits<size_t>::max());
+  EXPECT_EQ(whole.size(), 1U);
+  EXPECT_EQ(whole[0].size(), 10U);
+}
+
+TEST(span, SlicingViews) {
+  s21::array<int, 10> values = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  s21::span<int> all(values);
+  s21::strided_view<int> odds = all.subspan(1).strided(2);
+  EXPECT_EQ(odds.size(), 5U);
+  s21::strided_view<int> middle = odds.subview(1, 3);
+  EXPECT_EQ(middle.size(), 3U);
+  EXPECT_EQ(middle.stride(), 2U);
+  EXPECT_EQ(middle.front(), 3);
+  EXPECT_EQ(middle.back(), 7);
+  EXPECT_EQ(odds.first(2).back(), 3);
+  EXPECT_EQ(odds.last(2).front(), 7);
+  EXPECT_EQ(odds.subview(4).size(), 1U);
+  EXPECT_TRUE(odds.subview(5).empty());
+  EXPECT_THROW(odds.subview(6), std::out_of_range);
+  EXPECT_THROW(odds.subview(2, 4), std::out_of_range);
+  EXPECT_THROW(odds.last(6), std::out_of_range);
+
+  s21::chunk_view<int> chunks = all.chunks(4);
+  s21::chunk_view<int> tail = chunks.subview(1);
+  EXPECT_EQ(tail.size(), 2U);
+  EXPECT_EQ(tail[0].front(), 4);
+  EXPECT_EQ(tail[1].size(), 2U);
+  s21::chunk_view<int> head = chunks.first(2);
+  EXPECT_EQ(head.size(), 2U);
+  EXPECT_EQ(head[1].size(), 4U);
+  EXPECT_EQ(head[1].back(), 7);
+  EXPECT_EQ(chunks.last(1)[0].front(), 8);
+  EXPECT_TRUE(chunks.subview(3).empty());
+  EXPECT_THROW(chunks.subview(4), std::out_of_range);
+  EXPECT_THROW(chunks.first(4), std::out_of_range);
+
+  // A chunk is a span by value, so chunk_iterator is only an input iterator.
+  using ChunkTag =
+      std::iterator_traits<s21::chunk_iterator<int>>::iterator_category;
+  static_assert(std::is_same_v<ChunkTag, std::input_iterator_tag>);
+}
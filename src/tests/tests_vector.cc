@@ -812,12 +812,64 @@ TEST(Vector, SameTest_4) {
   EXPECT_EQ(s21_vector.back(), 34);
 }
 
+namespace {
+struct CopyCounter {
+  static int copies;
+  static int moves;
+  int value = 0;
+  CopyCounter() = default;
+  CopyCounter(int value) : value(value) {}
+  CopyCounter(const CopyCounter &other) : value(other.value) { ++copies; }
+  CopyCounter(CopyCounter &&other) noexcept : value(other.value) { ++moves; }
+  CopyCounter &operator=(const CopyCounter &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  CopyCounter &operator=(CopyCounter &&other) noexcept {
+    value = other.value;
+    ++moves;
+    return *this;
+  }
+};
+int CopyCounter::copies = 0;
+int CopyCounter::moves = 0;
+
+struct ThrowingMove {
+  int value = 0;
+  ThrowingMove() = default;
+  ThrowingMove(int value) : value(value) {}
+  ThrowingMove(const ThrowingMove &other) = default;
+  ThrowingMove(ThrowingMove &&other) noexcept(false) : value(other.value) {
+    other.value = -1;
+  }
+  ThrowingMove &operator=(const ThrowingMove &other) = default;
+};
+}  // namespace
+
+TEST(Vector, GrowthMovesElements) {
+  s21::vector<CopyCounter> s21_vector;
+  for (int i = 0; i < 100; ++i) s21_vector.push_back(CopyCounter(i));
+  CopyCounter::copies = 0;
+  s21_vector.reserve(1000);
+  s21_vector.shrink_to_fit();
+  EXPECT_EQ(CopyCounter::copies, 0);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(s21_vector[i].value, i);
+}
+
+TEST(Vector, GrowthCopiesThrowingMove) {
+  s21::vector<ThrowingMove> s21_vector = {1, 2, 3};
+  s21_vector.reserve(10);
+  EXPECT_EQ(s21_vector[0].value, 1);
+  EXPECT_EQ(s21_vector[2].value, 3);
+}
+
 TEST(Vector_Dop_method, Insert_many_1) {
   s21::vector<int> s21_vector = {34, 654, -23, 344, 8787};
 
   s21_vector.insert_many(s21_vector.begin(), 434, 111, 111);
   EXPECT_EQ(s21_vector.size(), 8);
-  EXPECT_EQ(s21_vector.capacity(), 8);
+  EXPECT_EQ(s21_vector.capacity(), 10);
   EXPECT_EQ(*s21_vector.begin(), 434);
 }
 
@@ -826,7 +878,7 @@ TEST(Vector_Dop_method, Insert_many_2) {
 
   s21_vector.insert_many(s21_vector.end(), 434, 111, 111);
   EXPECT_EQ(s21_vector.size(), 8);
-  EXPECT_EQ(s21_vector.capacity(), 8);
+  EXPECT_EQ(s21_vector.capacity(), 10);
   EXPECT_EQ(*(s21_vector.end() - 1), 111);
 }
 
@@ -871,7 +923,7 @@ TEST(Vector_Dop_method, Insert_many_back_1) {
 
   s21_vector.insert_many_back(434, 111, 111);
   EXPECT_EQ(s21_vector.size(), 8);
-  EXPECT_EQ(s21_vector.capacity(), 8);
+  EXPECT_EQ(s21_vector.capacity(), 10);
   EXPECT_EQ(*(s21_vector.end() - 1), 111);
 }
 
@@ -888,10 +940,499 @@ TEST(Vector_Dop_method, Insert_many_back_2) {
   s21_vector.insert_many_back("NOOOoooooooo");
 
   EXPECT_EQ(s21_vector.size(), 8);
-  EXPECT_EQ(s21_vector.capacity(), 8);
+  EXPECT_EQ(s21_vector.capacity(), 14);
   EXPECT_EQ(*(s21_vector.end() - 1), "NOOOoooooooo");
 }
 
+TEST(Vector_Dop_method, Insert_many_aliasing_in_capacity) {
+  std::string x(40, 'x'), y(40, 'y');
+  s21::vector<std::string> s21_vector = {x, y};
+  s21_vector.reserve(10);
+
+  s21_vector.insert_many(s21_vector.begin(), s21_vector.back(),
+                         s21_vector.front());
+  ASSERT_EQ(s21_vector.size(), 4);
+  EXPECT_EQ(s21_vector[0], y);
+  EXPECT_EQ(s21_vector[1], x);
+  EXPECT_EQ(s21_vector[2], x);
+  EXPECT_EQ(s21_vector[3], y);
+}
+
+TEST(Vector_Dop_method, Insert_many_aliasing_reallocating) {
+  std::string x(40, 'x'), y(40, 'y');
+  s21::vector<std::string> s21_vector = {x, y};
+  s21_vector.shrink_to_fit();
+
+  s21_vector.insert_many_back(s21_vector[0], s21_vector[1]);
+  ASSERT_EQ(s21_vector.size(), 4);
+  EXPECT_EQ(s21_vector[2], x);
+  EXPECT_EQ(s21_vector[3], y);
+
+  s21_vector.shrink_to_fit();
+  s21_vector.insert_many(s21_vector.begin() + 1, s21_vector[3]);
+  ASSERT_EQ(s21_vector.size(), 5);
+  EXPECT_EQ(s21_vector[1], y);
+  EXPECT_EQ(s21_vector[4], y);
+}
+
+namespace {
+struct Point {
+  int x;
+  double y;
+};
+}  // namespace
+
+TEST(Vector, TrivialRelocation) {
+  s21::vector<Point> s21_vector;
+  for (int i = 0; i < 1000; ++i) s21_vector.push_back(Point{i, i * 0.5});
+  s21_vector.insert(s21_vector.begin() + 10, Point{-1, -1.0});
+  s21_vector.erase(s21_vector.begin());
+  s21::vector<Point> copy_vector(s21_vector);
+  copy_vector.shrink_to_fit();
+  EXPECT_EQ(copy_vector.size(), 1000U);
+  EXPECT_EQ(copy_vector.capacity(), 1000U);
+  EXPECT_EQ(copy_vector[9].x, -1);
+  EXPECT_EQ(copy_vector[10].x, 10);
+  EXPECT_EQ(copy_vector[999].y, 499.5);
+}
+
+TEST(Vector, PushBackOwnElement) {
+  s21::vector<long> s21_vector = {7};
+  for (int i = 0; i < 10; ++i) s21_vector.push_back(s21_vector[0]);
+  EXPECT_EQ(s21_vector.size(), 11U);
+  EXPECT_EQ(s21_vector.back(), 7);
+}
+
+TEST(Vector, EmplaceBack) {
+  s21::vector<std::string> s21_vector;
+  std::vector<std::string> std_vector;
+  for (size_t i = 1; i < 20; ++i) {
+    s21_vector.emplace_back(i, 'a');
+    std_vector.emplace_back(i, 'a');
+  }
+  EXPECT_EQ(s21_vector.emplace_back("last"), "last");
+  std_vector.emplace_back("last");
+  ASSERT_EQ(s21_vector.size(), std_vector.size());
+  for (size_t i = 0; i < std_vector.size(); ++i)
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+}
+
+TEST(Vector, EmplaceBackOwnElement) {
+  s21::vector<std::string> s21_vector = {"first"};
+  for (int i = 0; i < 10; ++i) s21_vector.push_back(s21_vector[0]);
+  EXPECT_EQ(s21_vector.size(), 11U);
+  EXPECT_EQ(s21_vector.back(), "first");
+}
+
+TEST(Vector, EmplaceMiddle) {
+  s21::vector<std::string> s21_vector = {"a", "b", "c"};
+  std::vector<std::string> std_vector = {"a", "b", "c"};
+  auto it = s21_vector.emplace(s21_vector.begin() + 1, 3, 'x');
+  std_vector.emplace(std_vector.begin() + 1, 3, 'x');
+  EXPECT_EQ(*it, "xxx");
+  s21_vector.emplace(s21_vector.begin(), s21_vector[3]);
+  std_vector.emplace(std_vector.begin(), std_vector[3]);
+  ASSERT_EQ(s21_vector.size(), std_vector.size());
+  for (size_t i = 0; i < std_vector.size(); ++i)
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  EXPECT_ANY_THROW(s21_vector.emplace(s21_vector.end() + 1, "y"));
+}
+
+TEST(Vector, MoveOnlyElements) {
+  s21::vector<std::unique_ptr<int>> s21_vector;
+  for (int i = 0; i < 10; ++i) s21_vector.push_back(std::make_unique<int>(i));
+  s21_vector.emplace(s21_vector.begin() + 5, new int(-1));
+  s21_vector.emplace_back(std::make_unique<int>(10));
+  ASSERT_EQ(s21_vector.size(), 12U);
+  EXPECT_EQ(*s21_vector[4], 4);
+  EXPECT_EQ(*s21_vector[5], -1);
+  EXPECT_EQ(*s21_vector[6], 5);
+  EXPECT_EQ(*s21_vector.back(), 10);
+}
+
+TEST(Vector, PushBackRvalue) {
+  s21::vector<CopyCounter> s21_vector;
+  s21_vector.reserve(4);
+  CopyCounter::copies = 0;
+  s21_vector.push_back(CopyCounter(1));
+  CopyCounter value(2);
+  s21_vector.push_back(std::move(value));
+  s21_vector.emplace_back(3);
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(s21_vector[2].value, 3);
+}
+
+namespace {
+struct ThrowOnValue {
+  int value = 0;
+  std::string text;
+  ThrowOnValue(int value) : value(value), text(std::to_string(value)) {
+    if (value < 0) throw std::invalid_argument("negative");
+  }
+};
+}  // namespace
+
+TEST(Vector, InsertManyBackGrowsGeometrically) {
+  s21::vector<int> s21_vector;
+  size_t reallocations = 0;
+  size_t capacity = s21_vector.capacity();
+  for (int i = 0; i < 1000; ++i) {
+    s21_vector.insert_many_back(i, i + 1);
+    if (s21_vector.capacity() != capacity) {
+      capacity = s21_vector.capacity();
+      ++reallocations;
+    }
+  }
+  EXPECT_EQ(s21_vector.size(), 2000U);
+  EXPECT_LT(reallocations, 15U);
+  EXPECT_EQ(s21_vector[1998], 999);
+}
+
+TEST(Vector, InsertConstructsOnce) {
+  s21::vector<CopyCounter> s21_vector;
+  s21_vector.reserve(16);
+  for (int i = 0; i < 4; ++i) s21_vector.emplace_back(i);
+  CopyCounter value(7);
+  CopyCounter::copies = 0;
+  CopyCounter::moves = 0;
+  s21_vector.insert(s21_vector.begin() + 1, 3, value);
+  EXPECT_EQ(CopyCounter::copies, 4);
+  EXPECT_EQ(CopyCounter::moves, 3);
+  CopyCounter::copies = 0;
+  s21_vector.insert_many(s21_vector.begin(), CopyCounter(8), CopyCounter(9));
+  EXPECT_EQ(CopyCounter::copies, 0);
+  int expected[] = {8, 9, 0, 7, 7, 7, 1, 2, 3};
+  ASSERT_EQ(s21_vector.size(), 9U);
+  for (size_t i = 0; i < 9; ++i) EXPECT_EQ(s21_vector[i].value, expected[i]);
+}
+
+TEST(Vector, InsertManyThrowKeepsElements) {
+  s21::vector<ThrowOnValue> values;
+  values.reserve(10);
+  for (int i = 1; i <= 3; ++i) values.emplace_back(i);
+  EXPECT_ANY_THROW(values.insert_many(values.begin(), 4, 5, -1));
+  EXPECT_ANY_THROW(values.insert_many(values.begin() + 2, -1));
+  ASSERT_EQ(values.size(), 3U);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(values[i].value, i + 1);
+    EXPECT_EQ(values[i].text, std::to_string(i + 1));
+  }
+}
+
+TEST(Vector, RangeConstructor) {
+  std::list<std::string> source = {"one", "two", "three"};
+  s21::vector<std::string> s21_vector(source.begin(), source.end());
+  ASSERT_EQ(s21_vector.size(), 3U);
+  EXPECT_EQ(s21_vector.capacity(), 3U);
+  EXPECT_EQ(s21_vector[2], "three");
+
+  int raw[] = {5, 6, 7, 8};
+  s21::vector<int> ints(raw, raw + 4);
+  ASSERT_EQ(ints.size(), 4U);
+  EXPECT_EQ(ints.capacity(), 4U);
+  EXPECT_EQ(ints[3], 8);
+
+  ints.insert(ints.begin(), 2, 1);
+  EXPECT_EQ(ints.size(), 6U);
+  EXPECT_EQ(ints[1], 1);
+}
+
+TEST(Vector, RangeFromInputIterator) {
+  std::istringstream stream("1 2 3 4 5");
+  s21::vector<int> s21_vector = {10, 20};
+  s21_vector.insert(s21_vector.begin() + 1, std::istream_iterator<int>(stream),
+                    std::istream_iterator<int>());
+  int expected[] = {10, 1, 2, 3, 4, 5, 20};
+  ASSERT_EQ(s21_vector.size(), 7U);
+  for (size_t i = 0; i < 7; ++i) EXPECT_EQ(s21_vector[i], expected[i]);
+
+  std::istringstream other("7 8");
+  s21_vector.assign(std::istream_iterator<int>(other),
+                    std::istream_iterator<int>());
+  ASSERT_EQ(s21_vector.size(), 2U);
+  EXPECT_EQ(s21_vector[1], 8);
+}
+
+TEST(Vector, RangeInsert) {
+  s21::vector<std::string> s21_vector = {"a", "e"};
+  std::vector<std::string> std_vector = {"a", "e"};
+  std::list<std::string> source = {"b", "c", "d"};
+  auto it = s21_vector.insert(s21_vector.begin() + 1, source.begin(),
+                              source.end());
+  std_vector.insert(std_vector.begin() + 1, source.begin(), source.end());
+  EXPECT_EQ(*it, "b");
+  ASSERT_EQ(s21_vector.size(), std_vector.size());
+  EXPECT_EQ(s21_vector.capacity(), std_vector.capacity());
+  for (size_t i = 0; i < std_vector.size(); ++i)
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+
+  s21::vector<double> doubles = {1.0, 4.0};
+  double middle[] = {2.0, 3.0};
+  doubles.insert(doubles.begin() + 1, middle, middle + 2);
+  for (size_t i = 0; i < 4; ++i) EXPECT_EQ(doubles[i], i + 1.0);
+  EXPECT_ANY_THROW(doubles.insert(doubles.end() + 1, middle, middle + 2));
+}
+
+TEST(Vector, RangeAssign) {
+  s21::vector<std::string> s21_vector = {"a", "b", "c", "d"};
+  std::vector<std::string> small = {"x", "y"};
+  s21_vector.assign(small.begin(), small.end());
+  EXPECT_EQ(s21_vector.size(), 2U);
+  EXPECT_EQ(s21_vector.capacity(), 4U);
+  EXPECT_EQ(s21_vector[1], "y");
+
+  std::vector<std::string> large(10, "z");
+  s21_vector.assign(large.begin(), large.end());
+  EXPECT_EQ(s21_vector.size(), 10U);
+  EXPECT_EQ(s21_vector.capacity(), 10U);
+  EXPECT_EQ(s21_vector.back(), "z");
+
+  s21::vector<int> empty;
+  empty = {1, 2, 3};
+  EXPECT_EQ(empty.size(), 3U);
+  EXPECT_EQ(empty[2], 3);
+}
+
+TEST(Vector, AppendRange) {
+  s21::vector<int> s21_vector;
+  std::vector<int> chunk(1000);
+  for (int i = 0; i < 1000; ++i) chunk[i] = i;
+  s21_vector.append_range(chunk);
+  EXPECT_EQ(s21_vector.capacity(), 1000U);
+  s21_vector.reserve(5000);
+  for (int i = 0; i < 4; ++i) s21_vector.append_range(chunk);
+  EXPECT_EQ(s21_vector.capacity(), 5000U);
+  ASSERT_EQ(s21_vector.size(), 5000U);
+  EXPECT_EQ(s21_vector[4999], 999);
+  s21_vector.append_range(std::list<int>{-1});
+  EXPECT_EQ(s21_vector.back(), -1);
+}
+
+TEST(Vector, HalfGrowth) {
+  s21::vector<int, std::allocator<int>, s21::half_growth> s21_vector;
+  std::vector<size_t> capacities;
+  for (int i = 0; i < 100; ++i) {
+    s21_vector.push_back(i);
+    if (capacities.empty() || capacities.back() != s21_vector.capacity())
+      capacities.push_back(s21_vector.capacity());
+  }
+  std::vector<size_t> expected = {1,  2,  3,  4,  6,  9,  13,
+                                 19, 28, 42, 63, 94, 141};
+  EXPECT_EQ(capacities, expected);
+  EXPECT_EQ(s21_vector[99], 99);
+}
+
+TEST(Vector, ChunkGrowth) {
+  s21::vector<std::string, std::allocator<std::string>, s21::chunk_growth<64>>
+      s21_vector;
+  for (int i = 0; i < 65; ++i) s21_vector.emplace_back(1, 'a');
+  EXPECT_EQ(s21_vector.capacity(), 128U);
+  s21_vector.insert(s21_vector.begin(), 100, "b");
+  EXPECT_EQ(s21_vector.capacity(), 192U);
+  EXPECT_EQ(s21_vector.size(), 165U);
+  EXPECT_EQ(s21_vector.front(), "b");
+  EXPECT_EQ(s21_vector.back(), "a");
+}
+
+namespace {
+struct TripleGrowth {
+  static size_t next(size_t size, size_t) { return size * 3; }
+};
+}  // namespace
+
+TEST(Vector, CustomGrowth) {
+  s21::vector<int, std::allocator<int>, TripleGrowth> s21_vector;
+  s21_vector.push_back(1);
+  EXPECT_EQ(s21_vector.capacity(), 1U);
+  s21_vector.push_back(2);
+  EXPECT_EQ(s21_vector.capacity(), 3U);
+  s21_vector.insert_many_back(3, 4, 5, 6, 7, 8, 9, 10, 11, 12);
+  EXPECT_EQ(s21_vector.capacity(), 12U);
+  EXPECT_EQ(s21_vector.size(), 12U);
+}
+
+TEST(Vector, BlockRoundedGrowth) {
+  s21::vector<char, std::allocator<char>,
+              s21::block_rounded<s21::double_growth>>
+      s21_vector;
+  for (int i = 0; i < 1000; ++i) s21_vector.push_back('a' + i % 26);
+  EXPECT_GE(s21_vector.capacity(), s21_vector.size());
+  size_t capacity = s21_vector.capacity();
+  while (s21_vector.size() < capacity) s21_vector.push_back('z');
+  EXPECT_EQ(s21_vector.capacity(), capacity);
+  EXPECT_EQ(s21_vector[27], 'b');
+}
+
+namespace {
+// Allocator with an id that follows the vector on copy, move and swap.
+template <typename T>
+struct TaggedAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  int id = 0;
+  TaggedAllocator() = default;
+  explicit TaggedAllocator(int id) : id(id) {}
+  template <typename U>
+  TaggedAllocator(const TaggedAllocator<U> &other) : id(other.id) {}
+
+  T *allocate(size_t n) { return std::allocator<T>().allocate(n); }
+  void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+  TaggedAllocator select_on_container_copy_construction() const {
+    return TaggedAllocator(id + 100);
+  }
+  bool operator==(const TaggedAllocator &other) const {
+    return id == other.id;
+  }
+  bool operator!=(const TaggedAllocator &other) const {
+    return id != other.id;
+  }
+};
+}  // namespace
+
+TEST(Vector, AllocatorPropagation) {
+  using Vector = s21::vector<std::string, TaggedAllocator<std::string>>;
+  Vector first({"a", "b"}, TaggedAllocator<std::string>(1));
+  Vector second(TaggedAllocator<std::string>(2));
+  second.push_back("c");
+
+  Vector copy(first);
+  EXPECT_EQ(copy.get_allocator().id, 101);
+  EXPECT_EQ(copy[1], "b");
+
+  copy = second;
+  EXPECT_EQ(copy.get_allocator().id, 2);
+  EXPECT_EQ(copy.size(), 1U);
+
+  Vector moved(std::move(first));
+  EXPECT_EQ(moved.get_allocator().id, 1);
+  copy = std::move(moved);
+  EXPECT_EQ(copy.get_allocator().id, 1);
+  EXPECT_EQ(copy[0], "a");
+
+  copy.swap(second);
+  EXPECT_EQ(copy.get_allocator().id, 2);
+  EXPECT_EQ(second.get_allocator().id, 1);
+  EXPECT_EQ(second[1], "b");
+
+  Vector other(std::move(second), TaggedAllocator<std::string>(3));
+  EXPECT_EQ(other.get_allocator().id, 3);
+  ASSERT_EQ(other.size(), 2U);
+  EXPECT_EQ(other[0], "a");
+}
+
+TEST(Vector, EraseRange) {
+  s21::vector<std::string> s21_vector = {"a", "b", "c", "d", "e", "f"};
+  std::vector<std::string> std_vector = {"a", "b", "c", "d", "e", "f"};
+  auto it = s21_vector.erase(s21_vector.begin() + 1, s21_vector.begin() + 4);
+  std_vector.erase(std_vector.begin() + 1, std_vector.begin() + 4);
+  EXPECT_EQ(*it, "e");
+  ASSERT_EQ(s21_vector.size(), std_vector.size());
+  for (size_t i = 0; i < std_vector.size(); ++i)
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  EXPECT_EQ(s21_vector.erase(s21_vector.end(), s21_vector.end()),
+            s21_vector.end());
+  EXPECT_ANY_THROW(s21_vector.erase(s21_vector.begin() + 2,
+                                    s21_vector.begin() + 1));
+
+  s21::vector<int> ints = {1, 2, 3, 4, 5};
+  ints.erase(ints.begin(), ints.begin() + 2);
+  EXPECT_EQ(ints.size(), 3U);
+  EXPECT_EQ(ints.front(), 3);
+  ints.erase(ints.begin(), ints.end());
+  EXPECT_TRUE(ints.empty());
+}
+
+TEST(Vector, EraseDestroysElements) {
+  auto counter = std::make_shared<int>(0);
+  s21::vector<std::shared_ptr<int>> s21_vector;
+  for (int i = 0; i < 10; ++i) s21_vector.push_back(counter);
+  EXPECT_EQ(counter.use_count(), 11);
+  s21_vector.erase(s21_vector.begin());
+  EXPECT_EQ(counter.use_count(), 10);
+  s21_vector.erase(s21_vector.begin() + 2, s21_vector.begin() + 5);
+  EXPECT_EQ(counter.use_count(), 7);
+  s21_vector.swap_and_pop(s21_vector.begin());
+  EXPECT_EQ(counter.use_count(), 6);
+}
+
+TEST(Vector, EraseIf) {
+  s21::vector<int> ints;
+  for (int i = 0; i < 1000; ++i) ints.push_back(i);
+  EXPECT_EQ(s21::erase_if(ints, [](int value) { return value % 3 == 0; }),
+            334U);
+  ASSERT_EQ(ints.size(), 666U);
+  EXPECT_NE(ints[0] % 3, 0);
+  for (size_t i = 1; i < ints.size(); ++i) {
+    EXPECT_NE(ints[i] % 3, 0);
+    EXPECT_LT(ints[i - 1], ints[i]);
+  }
+  EXPECT_EQ(s21::erase_if(ints, [](int value) { return value < 500; }), 333U);
+  EXPECT_EQ(ints.front(), 500);
+  EXPECT_EQ(s21::erase(ints, 998), 1U);
+  EXPECT_EQ(ints.back(), 997);
+
+  s21::vector<std::string> words = {"keep", "drop", "keep", "drop", "last"};
+  EXPECT_EQ(s21::erase(words, "drop"), 2U);
+  ASSERT_EQ(words.size(), 3U);
+  EXPECT_EQ(words[2], "last");
+}
+
+TEST(Vector, SwapAndPop) {
+  s21::vector<int> ints = {1, 2, 3, 4};
+  auto it = ints.swap_and_pop(ints.begin() + 1);
+  EXPECT_EQ(*it, 4);
+  EXPECT_EQ(ints.size(), 3U);
+  ints.swap_and_pop(ints.end() - 1);
+  EXPECT_EQ(ints.size(), 2U);
+  EXPECT_EQ(ints.back(), 4);
+  EXPECT_ANY_THROW(ints.swap_and_pop(ints.end()));
+}
+
+TEST(Vector, Resize) {
+  s21::vector<int> ints = {1, 2, 3};
+  ints.resize(6);
+  EXPECT_EQ(ints.size(), 6U);
+  EXPECT_EQ(ints[2], 3);
+  EXPECT_EQ(ints[5], 0);
+  ints.resize(2);
+  EXPECT_EQ(ints.size(), 2U);
+  EXPECT_GE(ints.capacity(), 6U);
+  ints.resize(5, ints[0]);
+  EXPECT_EQ(ints[4], 1);
+
+  auto shared = std::make_shared<int>(7);
+  s21::vector<std::shared_ptr<int>> pointers;
+  pointers.resize(3, shared);
+  EXPECT_EQ(shared.use_count(), 4);
+  pointers.resize(1);
+  EXPECT_EQ(shared.use_count(), 2);
+  pointers.resize(4);
+  EXPECT_EQ(pointers[3], nullptr);
+  pointers.resize(0);
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(Vector, ResizeForOverwrite) {
+  s21::vector<char> buffer(4, s21::default_init);
+  EXPECT_EQ(buffer.size(), 4U);
+  std::memcpy(buffer.data(), "abcd", 4);
+  buffer.resize_for_overwrite(1000);
+  EXPECT_EQ(buffer.size(), 1000U);
+  EXPECT_EQ(std::string(buffer.begin(), buffer.begin() + 4), "abcd");
+  buffer.resize_for_overwrite(2);
+  EXPECT_EQ(buffer.size(), 2U);
+  EXPECT_EQ(buffer.back(), 'b');
+
+  s21::vector<std::string> words(3, s21::default_init);
+  EXPECT_EQ(words.size(), 3U);
+  EXPECT_TRUE(words[2].empty());
+  words.resize_for_overwrite(5);
+  EXPECT_TRUE(words[4].empty());
+}
+
 // int main(int argc, char **argv) {
 //   testing::InitGoogleTest(&argc, argv);
 //   return RUN_ALL_TESTS();